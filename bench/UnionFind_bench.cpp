@@ -0,0 +1,65 @@
+// Throughput of the sequential UnionFind against ConcurrentUnionFind on 1..N workers.
+// Usage: unionfind_bench [vertices] [operations]
+#include "../include/dsa/UnionFind.hpp"
+#include "../include/dsa/ConcurrentUnionFind.hpp"
+#include "../include/dsa/WorkerPool.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+
+static double seconds(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+static void report(const std::string &name, size_t ops, double secs) {
+    std::cout << name << ": " << secs * 1000 << " ms, " << ops / secs / 1e6 << " Mops/s" << std::endl;
+}
+
+int main(int argc, char *argv[]) {
+    int n = argc > 1 ? std::atoi(argv[1]) : 1 << 20;
+    size_t ops = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 8u << 20;
+
+    // Same mix for every run: a unite followed by a same-set query
+    std::mt19937 rng(7);
+    std::vector<std::pair<int, int>> pairs(ops);
+    for (auto &p : pairs) {
+        p = {static_cast<int>(rng() % n), static_cast<int>(rng() % n)};
+    }
+
+    auto start = Clock::now();
+    UnionFind uf(n);
+    size_t hits = 0;
+    for (auto [x, y] : pairs) {
+        uf.unite(x, y);
+        hits += uf.find_parent(y) == uf.find_parent(x);
+    }
+    report("UnionFind (sequential)", ops, seconds(start));
+    std::cout << "same-set hits: " << hits << std::endl;
+
+    unsigned maxWorkers = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned workers = 1; workers <= maxWorkers; workers *= 2) {
+        WorkerPool pool(workers);
+        start = Clock::now();
+        ConcurrentUnionFind cuf(n);
+        pool.parallelFor(ops, [&](size_t begin, size_t end, unsigned) {
+            for (size_t i = begin; i < end; i++) {
+                cuf.unite(pairs[i].first, pairs[i].second);
+                cuf.same_set(pairs[i].first, pairs[i].second);
+            }
+        });
+        report("ConcurrentUnionFind (" + std::to_string(workers) + " workers)", ops, seconds(start));
+        if (cuf.components() != uf.cc) {
+            std::cerr << "component count mismatch" << std::endl;
+            return 1;
+        }
+    }
+    return 0;
+}
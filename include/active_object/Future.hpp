@@ -46,6 +46,14 @@ public:
         cv.notify_all();
     }
 
+    // Set the result by moving it in
+    void set(T&& v) {
+        std::lock_guard<std::mutex> lock(mutex);
+        value = std::move(v);
+        ready = true;
+        cv.notify_all();
+    }
+
     // Get the result, blocking if necessary until it's available
     T get() {
         std::unique_lock<std::mutex> lock(mutex);
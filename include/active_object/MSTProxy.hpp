@@ -29,14 +29,20 @@ public:
     // One-way method to initialize a graph
     void initGraph(int n);
 
+    // One-way method to initialize a graph with a whole edge batch
+    void bulkLoad(int n, std::vector<std::tuple<int, int, int>> &&batch);
+
     // One-way method to add an edge
     void addEdge(int u, int v, int w);
 
     // One-way method to remove an edge
     void removeEdge(int u, int v);
 
-    // Two-way method that computes MST and returns a Future
-    Future<MST> computeMST(const std::string &algorithm);
+    // Two-way method that computes MST and returns a Future of the shared, read-only result
+    Future<std::shared_ptr<const MST>> computeMST(const std::string &algorithm);
+
+    // Two-way method that runs a script of edge changes and returns the weight at every MST query
+    Future<std::vector<long long>> runScript(std::vector<ScriptOp> &&ops);
 
     // Two-way method that returns MST weight
     Future<int> getWeight();
@@ -45,7 +51,22 @@ public:
     Future<int> getLongestDist();
 
     // Two-way method that returns the shortest distance in MST
-    Future<int> getShortestDist(const adj_list &originalGraph, int src, int dest);
+    Future<int> getShortestDist(int src, int dest);
+
+    // Two-way method that returns the tree distance between u and v in MST (NO_PATH if not connected)
+    Future<long long> getDistance(int u, int v);
+
+    // Two-way method that returns the tree distances of a whole batch of vertex pairs in MST
+    Future<std::vector<long long>> getDistances(std::vector<std::pair<int, int>> &&pairs);
+
+    // Two-way method that returns the heaviest edge on the MST path between u and v (NO_PATH if none)
+    Future<long long> getBottleneck(int u, int v);
+
+    // Two-way method that checks if u and v are connected using MST edges of weight <= threshold only
+    Future<bool> isConnected(int u, int v, int threshold);
+
+    // Two-way method that returns the number of vertices reachable from u over MST edges of weight <= threshold
+    Future<int> getComponentSize(int u, int threshold);
 
     // Two-way method that returns the average distance in MST
     Future<double> getAvgDist();
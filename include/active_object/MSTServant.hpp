@@ -2,23 +2,66 @@
 #define SERVANT_HPP
 #include "../dsa/Graph.hpp"
 #include "../dsa/MST.hpp"
+#include "../dsa/TreeIndex.hpp"
+#include "../dsa/KruskalTree.hpp"
+#include "../dsa/DynamicMST.hpp"
+#include "../dsa/OfflineDynamicMST.hpp"
 #include "../factory/ConcreteAlgoFactory.hpp"
 
+// Algorithm name reported for an MST served from the incrementally maintained forest
+#define INCREMENTAL "incremental"
+
 class MSTServant {
 private:
     Graph graph;
-    MST mst;
+    // Last MST, shared read-only with the callers of getMST_i
+    std::shared_ptr<const MST> mst = std::make_shared<const MST>();
+    // LCA index of mst, rebuilt whenever a new MST is produced
+    TreeIndex index;
+    // Kruskal reconstruction tree of mst, for the threshold queries
+    KruskalTree thresholds;
+    // Algorithm asked for and graph epoch mst was computed for, so asking again
+    // without a mutation in between is a lookup (0 - no MST yet)
+    std::string mstAlgo;
+    unsigned long mstEpoch = 0;
+    // toString_i result and the graph epoch it was built for
+    std::string graphText;
+    unsigned long graphTextEpoch = 0;
+    // Minimum spanning forest kept up to date by addEdge_i/removeEdge_i while dynamicValid is set.
+    // It is seeded by initGraph_i (empty graph) or, after a bulk load, by the first full
+    // computation that yields a spanning forest.
+    DynamicMST dynamic;
+    bool dynamicValid = false;
     ConcreteAlgoFactory& algo_factory;
+
+    // True if algo would produce a minimum spanning forest of the whole graph
+    // (the Prim variants only do that for connected undirected graphs)
+    bool isForestResult(const std::string& algo, int treeEdges);
+
+    // Make result the last MST and index it
+    void setMST(std::shared_ptr<const MST> result);
 public:
     MSTServant(ConcreteAlgoFactory& algo_factory): algo_factory(algo_factory) {}
     // Core operations that will be called by Method Requests
     void initGraph_i(int n);
+    void bulkLoad_i(int n, std::vector<std::tuple<int, int, int>> batch);
     void addEdge_i(int u, int v, int w);
     void removeEdge_i(int u, int v);
-    MST getMST_i(const std::string& algo);
+    std::shared_ptr<const MST> getMST_i(const std::string& algo);
+    // Apply a whole script of edge changes and answer its MST-weight queries offline
+    std::vector<long long> runScript_i(const std::vector<ScriptOp>& ops);
     int getWeight_i();
     int getLongestDist_i();
-    int getShortestDist_i(const adj_list &original_graph, int src, int dest);
+    int getShortestDist_i(int src, int dest);
+    // Tree distance between u and v in the last MST, NO_PATH if they are not connected
+    long long getDistance_i(int u, int v);
+    // getDistance_i of every pair, resolved together
+    std::vector<long long> getDistances_i(const std::vector<std::pair<int, int>>& pairs);
+    // Heaviest edge on the path between u and v in the last MST, NO_PATH if there is none
+    long long getBottleneck_i(int u, int v);
+    // Threshold queries on the last MST: only edges of weight <= threshold count
+    bool isConnected_i(int u, int v, int threshold);
+    int getComponentSize_i(int u, int threshold);
 
     double getAvgDist_i();
     std::string toString_i();
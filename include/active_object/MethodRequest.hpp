@@ -44,6 +44,27 @@ public:
     }
 };
 
+// BulkLoadRequest - Initialize a new graph together with its whole edge batch
+class BulkLoadRequest : public MethodRequest {
+private:
+    MSTServant* servant;
+    int vertices;
+    std::vector<std::tuple<int, int, int>> batch;
+
+public:
+    BulkLoadRequest(MSTServant* servant, int vertices, std::vector<std::tuple<int, int, int>> &&batch)
+        : servant(servant), vertices(vertices), batch(std::move(batch)) {}
+
+    bool guard() const override {
+        // Can always initialize a graph
+        return true;
+    }
+
+    void call() override {
+        servant->bulkLoad_i(vertices, std::move(batch));
+    }
+};
+
 // AddEdgeRequest - Add an edge to the graph
 class AddEdgeRequest : public MethodRequest {
 private:
@@ -87,12 +108,12 @@ class GetMSTRequest : public MethodRequest {
 private:
     MSTServant* servant;
     std::string algorithm;
-    Future<MST>* result;
+    Future<std::shared_ptr<const MST>>* result;
     
 public:
     GetMSTRequest(MSTServant* servant,
                      const std::string& algo,
-                     Future<MST>* result) 
+                     Future<std::shared_ptr<const MST>>* result) 
         : servant(servant), algorithm(algo), result(result) {}
     
     bool guard() const override {
@@ -101,9 +122,29 @@ public:
     }
     
     void call() override {
-        // Compute MST and store result in the future
-        MST mst = servant->getMST_i(algorithm);
-        result->set(mst);
+        // Compute MST and hand the shared result to the future
+        result->set(servant->getMST_i(algorithm));
+    }
+};
+
+// RunScriptRequest - Apply a script of edge changes and answer its MST queries offline
+class RunScriptRequest : public MethodRequest {
+private:
+    MSTServant* servant;
+    std::vector<ScriptOp> ops;
+    Future<std::vector<long long>>* result;
+
+public:
+    RunScriptRequest(MSTServant* servant, std::vector<ScriptOp> &&ops, Future<std::vector<long long>>* result)
+        : servant(servant), ops(std::move(ops)), result(result) {}
+
+    bool guard() const override {
+        // Can only run a script if graph is initialized
+        return servant->isGraphInitialized_i();
+    }
+
+    void call() override {
+        result->set(servant->runScript_i(ops));
     }
 };
 
@@ -151,13 +192,12 @@ public:
 class GetShortestDistRequest : public MethodRequest {
 private:
     int s, d;
-    const adj_list &graph;
     MSTServant* servant;
     Future<int>* result;
 
 public:
-    GetShortestDistRequest(MSTServant* servant, Future<int>* result, const adj_list &graph, int s, int d)
-        : s(s), d(d), graph(graph), servant(servant), result(result) {}
+    GetShortestDistRequest(MSTServant* servant, Future<int>* result, int s, int d)
+        : s(s), d(d), servant(servant), result(result) {}
 
     bool guard() const override {
         // Can only get shortest distance if MST has been computed
@@ -165,11 +205,121 @@ public:
     }
 
     void call() override {
-        int distance = servant->getShortestDist_i(graph, s, d);
+        int distance = servant->getShortestDist_i(s, d);
+        result->set(distance);
+    }
+};
+
+// GetDistanceRequest - Get the tree distance between two vertices of the MST
+class GetDistanceRequest : public MethodRequest {
+private:
+    int u, v;
+    MSTServant* servant;
+    Future<long long>* result;
+
+public:
+    GetDistanceRequest(MSTServant* servant, Future<long long>* result, int u, int v)
+        : u(u), v(v), servant(servant), result(result) {}
+
+    bool guard() const override {
+        // Clients send this on their own: before any MST the empty index answers NO_PATH
+        return true;
+    }
+
+    void call() override {
+        long long distance = servant->getDistance_i(u, v);
         result->set(distance);
     }
 };
 
+// GetDistancesRequest - Get the tree distances of a batch of vertex pairs of the MST
+class GetDistancesRequest : public MethodRequest {
+private:
+    std::vector<std::pair<int, int>> pairs;
+    MSTServant* servant;
+    Future<std::vector<long long>>* result;
+
+public:
+    GetDistancesRequest(MSTServant* servant, std::vector<std::pair<int, int>>&& pairs,
+                        Future<std::vector<long long>>* result)
+        : pairs(std::move(pairs)), servant(servant), result(result) {}
+
+    bool guard() const override {
+        // Clients send this on their own: before any MST every pair gets NO_PATH
+        return true;
+    }
+
+    void call() override {
+        result->set(servant->getDistances_i(pairs));
+    }
+};
+
+// GetBottleneckRequest - Get the heaviest edge on the MST path between two vertices
+class GetBottleneckRequest : public MethodRequest {
+private:
+    int u, v;
+    MSTServant* servant;
+    Future<long long>* result;
+
+public:
+    GetBottleneckRequest(MSTServant* servant, Future<long long>* result, int u, int v)
+        : u(u), v(v), servant(servant), result(result) {}
+
+    bool guard() const override {
+        // Clients send this on their own: before any MST the empty index answers NO_PATH
+        return true;
+    }
+
+    void call() override {
+        long long weight = servant->getBottleneck_i(u, v);
+        result->set(weight);
+    }
+};
+
+// IsConnectedRequest - Check if two vertices are connected by MST edges of weight <= threshold
+class IsConnectedRequest : public MethodRequest {
+private:
+    int u, v, threshold;
+    MSTServant* servant;
+    Future<bool>* result;
+
+public:
+    IsConnectedRequest(MSTServant* servant, Future<bool>* result, int u, int v, int threshold)
+        : u(u), v(v), threshold(threshold), servant(servant), result(result) {}
+
+    bool guard() const override {
+        // Clients send this on their own: before any MST the empty KruskalTree knows no vertex
+        return true;
+    }
+
+    void call() override {
+        bool connected = servant->isConnected_i(u, v, threshold);
+        result->set(connected);
+    }
+};
+
+// GetComponentSizeRequest - Get the size of a vertex's component over MST edges of weight <= threshold
+class GetComponentSizeRequest : public MethodRequest {
+private:
+    int u, threshold;
+    MSTServant* servant;
+    Future<int>* result;
+
+public:
+    GetComponentSizeRequest(MSTServant* servant, Future<int>* result, int u, int threshold)
+        : u(u), threshold(threshold), servant(servant), result(result) {}
+
+    bool guard() const override {
+        // Clients send this on their own: before any MST the empty KruskalTree knows no vertex
+        return true;
+    }
+
+    void call() override {
+        int size = servant->getComponentSize_i(u, threshold);
+        result->set(size);
+    }
+};
+
 // GetAvgDistRequest - Get the average distance in the MST
 class GetAvgDistRequest : public MethodRequest {
 private:
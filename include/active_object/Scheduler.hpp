@@ -3,6 +3,7 @@
 
 #include <thread>
 #include <atomic>
+#include <iostream>
 #include "MethodRequest.hpp"
 #include "ActivationQ.hpp"
 
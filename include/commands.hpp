@@ -6,6 +6,14 @@ const std::string ADDEDGE = "add_edge";
 const std::string REMOVEEDGE = "remove_edge";
 const std::string MSTKRUSKAL = "mst_kruskal";
 const std::string MSTPRIM = "mst_prim";
+const std::string MSTBORUVKA = "mst_boruvka";
+const std::string MSTAUTO = "mst_auto";
 const std::string PRINTGRAPH = "print_graph";
+const std::string RUNSCRIPT = "run_script";
+const std::string DISTANCE = "distance";
+const std::string DISTANCES = "distances";
+const std::string BOTTLENECK = "bottleneck";
+const std::string CONNECTED = "connected";
+const std::string COMPONENTSIZE = "component_size";
 
 #endif //COMMANDS_HPP
@@ -0,0 +1,24 @@
+#ifndef CSRGRAPH_HPP
+#define CSRGRAPH_HPP
+#include <vector>
+#include <utility>
+
+// Read-only compressed-sparse-row snapshot of a Graph.
+// The out-edges of vertex u occupy positions [offsets[u], offsets[u + 1]) of the
+// flat edge arrays, in the same order as the adjacency list they were built from.
+// Edge ids are assigned the same way Graph::getAsPair() numbers them.
+struct CSRGraph {
+    int n = 0, m = 0;
+    std::vector<int> offsets; // n + 1 entries
+    std::vector<int> sources;
+    std::vector<int> targets;
+    std::vector<int> weights;
+    std::vector<int> ids;
+
+    CSRGraph() = default;
+
+    explicit CSRGraph(const std::vector<std::vector<std::pair<int, int>>> &adj);
+
+    int degree(int u) const { return offsets[u + 1] - offsets[u]; }
+};
+#endif //CSRGRAPH_HPP
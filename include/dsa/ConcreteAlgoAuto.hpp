@@ -0,0 +1,66 @@
+#ifndef CONCRETEALGOAUTO_HPP
+#define CONCRETEALGOAUTO_HPP
+#include <functional>
+#include <string>
+#include "../factory/AbstractProductAlgo.hpp"
+
+// What the cost model knows about a graph before choosing an algorithm
+struct GraphFeatures {
+    double n = 0, m = 0;
+    double weightRange = 0; // max weight - min weight
+    double cores = 1;
+};
+
+// One registered MST implementation as seen by the cost model
+struct AlgoCandidate {
+    std::string id;                                  // factory id
+    std::function<double(const GraphFeatures &)> work; // predicted amount of work, up to a constant
+    bool prim;                                       // grows a tree from vertex 0 along out-edges
+};
+
+// Picks the MST implementation with the lowest predicted running time.
+// The prediction for a candidate is coefficient * work(features), where the coefficients are measured
+// once per process by running every candidate on synthetic sparse and dense graphs, so the thresholds
+// follow the machine instead of being hard-coded.
+// The result is always a minimum spanning forest of the undirected view of the graph, like Kruskal.
+// The Prim variants are only candidates when that is also what they compute (symmetric, connected graph).
+class ConcreteAlgoAuto : public AbstractProductAlgo {
+private:
+    std::string chosen;
+
+public:
+    ~ConcreteAlgoAuto() override = default;
+
+    MST *execute(Graph &graph) override;
+
+    // Same choice from the snapshot alone. There is no cached symmetry check without the Graph,
+    // so the Prim variants are left out.
+    vector<tuple<int, int, int, int>> solve(const CSRGraph &csr) override;
+
+    // Factory id of the algorithm used by the last execute() or solve()
+    const std::string &getChosen() const { return chosen; }
+
+    // Cheapest candidate for the given features according to the calibrated model
+    static std::string choose(const GraphFeatures &features, bool allowPrim);
+
+    static GraphFeatures features(const CSRGraph &csr);
+
+    static const std::vector<AlgoCandidate> &candidates();
+
+    // True if the calibrated model predicts the array based Prim to beat the heap based one
+    // on a graph of n vertices and m edges. This is the density switch of ConcreteAlgoPrim.
+    // Never runs the benchmark itself: false until calibrate() or an Auto choice has calibrated.
+    static bool densePrimFaster(int n, int m);
+
+    // Runs the built-in benchmark now instead of on the first Auto request (server startup)
+    static void calibrate();
+
+private:
+    // Calibrated coefficient of every candidate, in candidates() order
+    static const std::vector<double> &coefficients();
+
+    // Calibrated coefficients of the heap based and the array based Prim, calibrated on their own
+    // so that the switch does not have to run the candidates that use the worker pool
+    static const std::pair<double, double> &primCoefficients();
+};
+#endif //CONCRETEALGOAUTO_HPP
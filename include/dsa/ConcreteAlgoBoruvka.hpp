@@ -0,0 +1,27 @@
+#ifndef CONCRETEALGOBORUVKA_HPP
+#define CONCRETEALGOBORUVKA_HPP
+#include "../factory/AbstractProductAlgo.hpp"
+#include "ConcurrentUnionFind.hpp"
+#include "WorkerPool.hpp"
+
+class ConcreteAlgoBoruvka : public AbstractProductAlgo {
+private:
+    WorkerPool &pool;
+
+    // Implementation of Boruvka's algorithm for finding a minimum spanning forest.
+    // Every round each component picks its lightest incident edge (edges are treated as undirected),
+    // the picked edges are contracted, and edges inside a component are filtered out.
+    // The edge scans and the contraction of a round run in parallel on the worker pool (sharing a
+    // lock-free union find), ties are broken by edge position so the picked edges never close a cycle.
+    // Complexity: O(m log n) work, O(log n) rounds
+    vector<tuple<int, int, int, int>> boruvka(const CSRGraph &csr);
+
+public:
+    explicit ConcreteAlgoBoruvka(WorkerPool &pool = WorkerPool::shared()) : pool(pool) {
+    }
+
+    ~ConcreteAlgoBoruvka() override = default;
+
+    vector<tuple<int, int, int, int>> solve(const CSRGraph &csr) override { return boruvka(csr); }
+};
+#endif //CONCRETEALGOBORUVKA_HPP
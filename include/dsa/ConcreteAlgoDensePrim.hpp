@@ -0,0 +1,29 @@
+#ifndef CONCRETEALGODENSEPRIM_HPP
+#define CONCRETEALGODENSEPRIM_HPP
+#include "../factory/AbstractProductAlgo.hpp"
+
+// Below this many vertices Prim keeps its heap without asking the cost model
+#define DENSE_PRIM_MIN_VERTICES 2048
+
+class ConcreteAlgoDensePrim : public AbstractProductAlgo {
+private:
+    // Implementation of the array based Prim's algorithm for dense graphs, starting at vertex 0
+    // and following out-edges like ConcreteAlgoPrim.
+    // Instead of a heap it keeps the distance of every vertex to the tree in a contiguous array.
+    // Finding the nearest vertex is a linear min scan and relaxing a row compares a gathered
+    // block of distances against the row weights, both vectorized with AVX2 or SSE4.1 when the
+    // CPU has them (chosen at runtime, with a scalar fallback).
+    // Complexity: O(n^2 + m)
+    vector<tuple<int, int, int, int>> densePrim(const CSRGraph &csr);
+
+public:
+    ~ConcreteAlgoDensePrim() override = default;
+
+    vector<tuple<int, int, int, int>> solve(const CSRGraph &csr) override { return densePrim(csr); }
+
+    // Whether the graph is dense enough for the O(n^2) variant to beat the heap, according to
+    // the cost model calibrated by ConcreteAlgoAuto. Only graphs of at least DENSE_PRIM_MIN_VERTICES
+    // vertices are considered, and never before the model has been calibrated.
+    static bool prefers(const CSRGraph &csr);
+};
+#endif //CONCRETEALGODENSEPRIM_HPP
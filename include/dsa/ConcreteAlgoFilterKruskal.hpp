@@ -0,0 +1,33 @@
+#ifndef CONCRETEALGOFILTERKRUSKAL_HPP
+#define CONCRETEALGOFILTERKRUSKAL_HPP
+#include "../factory/AbstractProductAlgo.hpp"
+#include "UnionFind.hpp"
+
+// Below this many edges a range is simply sorted and swept
+#define FILTER_KRUSKAL_BASE 1024
+
+class ConcreteAlgoFilterKruskal : public AbstractProductAlgo {
+private:
+    // Implementation of Filter-Kruskal (Osipov, Sanders, Singler).
+    // The edge range is split around a pivot weight. The light part is solved first, then edges
+    // of the heavy part whose endpoints are already connected are filtered out before it is
+    // solved, so most heavy edges of a dense graph are never sorted.
+    // Stops as soon as the spanning forest is a single tree.
+    // Complexity: O(m + n log n log(m/n)) expected on random weights
+    vector<tuple<int, int, int, int>> filterKruskal(const CSRGraph &csr);
+
+    // Recursive step over order[lo, hi). Once depth runs out (repeatedly bad pivots) the range is
+    // sorted and swept instead, bounding the recursion like introsort does.
+    void filter(const CSRGraph &csr, vector<int> &order, size_t lo, size_t hi, int depth, UnionFind &uf,
+                vector<tuple<int, int, int, int>> &result);
+
+    // Plain Kruskal sweep over order[lo, hi), which must already be sorted by weight
+    void sweep(const CSRGraph &csr, const vector<int> &order, size_t lo, size_t hi, UnionFind &uf,
+               vector<tuple<int, int, int, int>> &result);
+
+public:
+    ~ConcreteAlgoFilterKruskal() override = default;
+
+    vector<tuple<int, int, int, int>> solve(const CSRGraph &csr) override { return filterKruskal(csr); }
+};
+#endif //CONCRETEALGOFILTERKRUSKAL_HPP
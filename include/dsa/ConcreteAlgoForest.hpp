@@ -0,0 +1,36 @@
+#ifndef CONCRETEALGOFOREST_HPP
+#define CONCRETEALGOFOREST_HPP
+#include <string>
+#include "../factory/AbstractProductAlgo.hpp"
+#include "ConcurrentUnionFind.hpp"
+#include "WorkerPool.hpp"
+
+class ConcreteAlgoForest : public AbstractProductAlgo {
+private:
+    std::string innerId;
+    WorkerPool &pool;
+
+    // Symmetric CSR of one component: every edge in both directions, local vertex numbers,
+    // and the global CSR position of the edge as its id
+    static CSRGraph component(const CSRGraph &csr, int vertices, const vector<int> &edges,
+                              const vector<int> &local);
+
+public:
+    // Minimum spanning forest mode for the product with factory id innerId.
+    // The connected components of the undirected view are labelled first (parallel unites on a
+    // lock-free union find), every component becomes a symmetric CSR of its own, and the
+    // components are solved concurrently on the worker pool, largest first, by one instance of
+    // the product per worker. The result is a minimum spanning forest of the whole graph even for
+    // products that grow a single tree from vertex 0 (Prim), and every edge keeps its original
+    // direction and id.
+    // The product runs inside pool jobs, so it must not use the pool itself.
+    // Complexity: O(n + m) to split, plus the product on every component
+    explicit ConcreteAlgoForest(const std::string &innerId, WorkerPool &pool = WorkerPool::shared())
+        : innerId(innerId), pool(pool) {
+    }
+
+    ~ConcreteAlgoForest() override = default;
+
+    vector<tuple<int, int, int, int>> solve(const CSRGraph &csr) override;
+};
+#endif //CONCRETEALGOFOREST_HPP
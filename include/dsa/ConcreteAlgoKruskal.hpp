@@ -2,17 +2,43 @@
 #define CONCRETEALGOKRUSKAL_HPP
 #include "../factory/AbstractProductAlgo.hpp"
 #include "UnionFind.hpp"
+#include "KruskalTree.hpp"
+#include "WorkerPool.hpp"
+
+// Edges looked up together by one batched union-find find
+#define KRUSKAL_WINDOW 64
+
+// How Kruskal orders the edges before the union-find sweep
+enum class KruskalSort {
+    Comparison, // std::sort on weights, the reference for benchmarks
+    Integer,    // sequential counting / LSD radix sort
+    Parallel    // LSD radix sort split across the worker pool
+};
+
 class ConcreteAlgoKruskal : public AbstractProductAlgo {
 private:
+    KruskalSort mode;
+    WorkerPool &pool;
+
     // Implementation of Kruskal's algorithm for finding MST
     // Assumptions: We receive the edges of a connected graph.
-    // Complexity: O(m log n)
-    vector<tuple<int, int, int, int>> kruskal(const vector<tuple<int, int, int, int>>& graph_edges,
-                                                        int n);
+    // Edges are ordered by a counting or LSD radix sort on their integer weights (see KruskalSort),
+    // the union-find sweep itself is always sequential. It resolves the endpoints of KRUSKAL_WINDOW
+    // edges at a time with one batched find and only calls unite for edges whose endpoints were apart.
+    // Complexity: O(m * ceil(log2(weight range) / RADIX_BITS) + m * inverse_ack(n))
+    vector<tuple<int, int, int, int>> kruskal(const CSRGraph &csr);
 
+    vector<int> sortEdges(const CSRGraph &csr);
 
 public:
+    explicit ConcreteAlgoKruskal(KruskalSort mode = KruskalSort::Integer, WorkerPool &pool = WorkerPool::shared())
+        : mode(mode), pool(pool) {
+    }
+
     ~ConcreteAlgoKruskal() override = default;
-    MST * execute(Graph &graph) override;
+    vector<tuple<int, int, int, int>> solve(const CSRGraph &csr) override { return kruskal(csr); }
+
+    // Kruskal reconstruction tree of the minimum spanning forest, built from the sweep's unions in order
+    KruskalTree reconstructionTree(const CSRGraph &csr) { return KruskalTree(csr.n, kruskal(csr)); }
 };
-#endif //CONCRETEALGOKRUSKAL_HPP
\ No newline at end of file
+#endif //CONCRETEALGOKRUSKAL_HPP
@@ -1,33 +1,27 @@
 #ifndef CONCRETEALGOPRIM_HPP
 #define CONCRETEALGOPRIM_HPP
-#define INF 0x3f3f3f3f
 #include "../factory/AbstractProductAlgo.hpp"
-#include <iostream>
-struct Edge {
-    int w = INF, to = -1, id;
-
-    bool operator<(Edge const &other) const {
-        return make_pair(w, to) < make_pair(other.w, other.to);
-    }
-
-    Edge() {
-        w = INF;
-        to = -1;
-    }
-
-    Edge(int _w, int _to, int _id) : w(_w), to(_to), id(_id) {
-    }
-};
+#include "IndexedHeap.hpp"
 
 class ConcreteAlgoPrim : public AbstractProductAlgo {
 private:
-    vector<tuple<int, int, int, int> > _prim(const vector<vector<Edge> > &adj, int n);
+    // Implementation of Prim's algorithm starting at vertex 0 and following out-edges.
+    // The frontier is an indexed 4-ary heap keyed by the lightest known edge weight of every
+    // vertex, and via[v] keeps the CSR position of that edge, so its source vertex is known
+    // the moment v is popped.
+    // Complexity: O(m log n)
+    vector<tuple<int, int, int, int> > prim(const CSRGraph &csr);
 
-    vector<tuple<int, int, int, int> > prim(const vector<tuple<int, int, int, int> > &edges, int n);
+    bool allowDense;
 
 public:
+    // With allowDense, solve() hands the graphs ConcreteAlgoDensePrim::prefers to that variant.
+    // Without it the heap is always used (how the cost model calibrates this variant).
+    explicit ConcreteAlgoPrim(bool allowDense = true) : allowDense(allowDense) {
+    }
+
     ~ConcreteAlgoPrim() override = default;
 
-    MST *execute(Graph &graph) override;
+    vector<tuple<int, int, int, int>> solve(const CSRGraph &csr) override;
 };
-#endif //CONCRETEALGOPRIM_HPP
\ No newline at end of file
+#endif //CONCRETEALGOPRIM_HPP
@@ -0,0 +1,28 @@
+#ifndef CONCURRENT_UNION_FIND_H
+#define CONCURRENT_UNION_FIND_H
+
+#include <atomic>
+#include <vector>
+
+// Lock-free Union Find (Disjoint Set Union) that many threads can share.
+// The parent array is atomic: finds do path splitting with a single CAS per step
+// and never wait for other threads, unite links two roots with one CAS and retries
+// if another thread linked one of them first.
+// Roots are linked by index (lower index under higher), which keeps the parent
+// pointers acyclic without a shared rank array.
+// Complexity: unite -> O( log(n) ) amortized, find_parent -> O( log(n) ) amortized
+struct ConcurrentUnionFind
+{
+    ConcurrentUnionFind(int _n);
+    int find_parent(int node);
+    bool unite(int x, int y);
+    // True if x and y are in the same set at some point during the call
+    bool same_set(int x, int y);
+    // Number of sets left, exact once no unite is running
+    int components() const { return cc.load(std::memory_order_relaxed); }
+    std::vector<std::atomic<int>> parent;
+    int n;
+    std::atomic<int> cc;
+};
+
+#endif
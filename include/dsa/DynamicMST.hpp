@@ -0,0 +1,75 @@
+#ifndef DYNAMICMST_HPP
+#define DYNAMICMST_HPP
+#include "LinkCutTree.hpp"
+#include "MST.hpp"
+#include <unordered_map>
+
+// Minimum spanning forest of a graph kept up to date under edge insertions, removals
+// and weight changes.
+// Edges are treated as undirected and identified by their directed (s, t) pair, the same
+// way the MST algorithms read them from the CSR. The forest lives in a link-cut tree:
+// - a new (or lighter) edge either joins two trees or replaces the heaviest edge on the
+//   tree path between its endpoints if it is lighter
+// - a removed (or heavier) tree edge is cut, and the lightest edge between the two halves
+//   is linked in its place. The halves are searched from both ends at once, so only the
+//   smaller half and its incident edges are ever scanned.
+// Complexity: insertion -> O(log n) amortized,
+//             tree edge deletion -> O(log n + size and degree sum of the smaller half),
+//             toMST -> O(n log n)
+// Tree edge deletion is not polylogarithmic: when both halves stay large it is linear in the
+// graph size. The polylog amortized bound needs the Holm-de Lichtenberg-Thorup level structure
+// together with its decremental to fully dynamic reduction, which this class does not implement.
+class DynamicMST {
+public:
+    explicit DynamicMST(int n = 0);
+
+    // Seed with all edges of csr and a minimum spanning forest of it (as computed by an MST algorithm)
+    DynamicMST(const CSRGraph &csr, const MST &forest);
+
+    // Edge (s, t) was added with weight w, or its weight changed to w
+    void addEdge(int s, int t, int w);
+
+    // Edge (s, t) was removed
+    void removeEdge(int s, int t);
+
+    int getNumVertices() const { return n; }
+
+    int getNumEdges() const { return static_cast<int>(treeEdges.size()); }
+
+    long long getTotalWeight() const { return totalWeight; }
+
+    MST toMST() const;
+
+private:
+    struct TreeEdge {
+        int s, t, w;
+    };
+
+    int n;
+    // Vertex v is node v, every tree edge is a node of its own between its endpoints
+    LinkCutTree tree;
+    // Tree edge (s, t) -> its node, and node -> tree edge
+    std::unordered_map<long long, int> treeEdges;
+    std::vector<TreeEdge> edgeAt;
+    // Tree edge nodes at every vertex, for walking a tree
+    std::vector<std::vector<int>> treeAt;
+    // Every edge of the graph at both its endpoints: edge key -> weight
+    std::vector<std::unordered_map<long long, int>> incident;
+    long long totalWeight = 0;
+    // Scratch space for the replacement search: visit stamps and the two search frontiers
+    std::vector<unsigned> seen;
+    unsigned stamp = 0;
+    std::vector<int> sides[2];
+
+    static long long key(int s, int t) { return (static_cast<long long>(s) << 32) | static_cast<unsigned>(t); }
+
+    void insert(int s, int t, int w);
+
+    void link(int s, int t, int w);
+
+    // Cut a tree edge and link the lightest edge reconnecting its two halves, if any
+    void replace(int node);
+
+    void cut(int node);
+};
+#endif //DYNAMICMST_HPP
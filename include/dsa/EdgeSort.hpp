@@ -0,0 +1,33 @@
+#ifndef EDGESORT_HPP
+#define EDGESORT_HPP
+#include <cstdint>
+#include <vector>
+#include "CSRGraph.hpp"
+#include "WorkerPool.hpp"
+
+// Digit width of the LSD radix sort (2048 buckets fit in L1)
+#define RADIX_BITS 11
+// Weight ranges up to this size are sorted with a single counting pass
+#define COUNTING_SORT_MAX_RANGE (1 << 16)
+
+// Integer sorts of the CSR edge positions by weight.
+// Weights are shifted by the minimum weight so only the bits of the observed range are sorted,
+// and only a compact (key, position) array is moved instead of whole edges.
+// All of them are stable, so equal weights keep their CSR order.
+
+// Picks counting sort for small weight ranges and LSD radix sort otherwise
+std::vector<int> sortEdgesByWeight(const CSRGraph &csr);
+
+// Complexity: O(m + range)
+std::vector<int> countingSortByWeight(const CSRGraph &csr, int minWeight, uint32_t range);
+
+// Complexity: O(m * ceil(log2(range) / RADIX_BITS))
+std::vector<int> radixSortByWeight(const CSRGraph &csr, int minWeight, uint32_t range);
+
+// LSD radix sort split across the worker pool. Every pass each worker histograms its own
+// chunk, the histograms are combined bucket-major, and each worker scatters its chunk to
+// its own slice of every bucket, which keeps the sort stable.
+// Falls back to sortEdgesByWeight below a few chunks' worth of edges.
+// Complexity: O(m * ceil(log2(range) / RADIX_BITS) / workers + workers * 2^RADIX_BITS) per pass
+std::vector<int> parallelSortEdgesByWeight(const CSRGraph &csr, WorkerPool &pool);
+#endif //EDGESORT_HPP
@@ -4,11 +4,27 @@
 #include <vector>
 #include <tuple>
 #include <set>
+#include <unordered_map>
+#include "CSRGraph.hpp"
+// Out-degree above which a vertex gets a hashed target -> position index
+#define EDGE_INDEX_THRESHOLD 32
 using adj_list = std::vector<std::vector<std::pair<int, int>>>;
 
 class Graph {
     adj_list graph;
     int vertices, edges;
+    // Mutation epoch: a process-wide unique stamp that changes on every mutation
+    unsigned long epoch;
+    // Cached CSR snapshot and the epoch it was built for (0 - never built)
+    CSRGraph csr;
+    unsigned long csrEpoch = 0;
+    // Edge index for hub vertices: hubIndex[s][t] is the position of edge (s,t) in graph[s].
+    // A vertex has an entry exactly while its out-degree is above EDGE_INDEX_THRESHOLD,
+    // low-degree vertices are scanned linearly (their rows fit in a cache line or two).
+    std::unordered_map<int, std::unordered_map<int, int>> hubIndex;
+    // Cached isUndirected() answer and the epoch it was computed for
+    bool undirected = false;
+    unsigned long undirectedEpoch = 0;
 
 public:
     Graph(int v);
@@ -16,10 +32,18 @@ public:
 
     explicit Graph(adj_list &graph);
 
-    Graph() : vertices(0), edges(0) {}
+    // Bulk build from a batch of (s, t, w) edges. Duplicate (s, t) pairs keep the weight
+    // of the last occurrence and invalid edges are dropped (with a warning), exactly as if
+    // every edge had been passed to addEdge in order, but the adjacency is built in a single
+    // pass. The batch is taken by value and sorted in place: std::move it in to avoid the copy.
+    Graph(int v, std::vector<std::tuple<int, int, int>> batch);
+
+    Graph();
 
     void addEdge(int s, int t, int w); // directed (s-source, t-target) weighted (w-weight) graph
 
+    // O(1): the last edge of graph[s] is moved into the freed slot, so the order of the
+    // remaining edges in that row is not preserved.
     void removeEdge(int s, int t);
 
     int getVertices() const { return vertices; }
@@ -28,8 +52,23 @@ public:
 
     bool isEmpty() const { return vertices == 0 && edges == 0; }
 
+    unsigned long getEpoch() const { return epoch; }
+
+    // CSR view of the current graph, rebuilt at most once per mutation epoch
+    const CSRGraph& getCSR();
+
+    // True if every edge (s,t,w) has a reverse edge (t,s,w), cached per mutation epoch
+    bool isUndirected();
+
     std::pair<std::vector<std::tuple<int, int, int, int>>, int> getAsPair();
 private:
     bool edgeExists(int u, int v) const;
+
+    // Position of edge (u,v) in graph[u], or -1 if there is none
+    int findEdge(int u, int v) const;
+
+    void buildIndex(int u);
+
+    void touch();
 };
-#endif //GRAPH_HPP
\ No newline at end of file
+#endif //GRAPH_HPP
@@ -0,0 +1,93 @@
+#ifndef INDEXEDHEAP_HPP
+#define INDEXEDHEAP_HPP
+#include <vector>
+#include <functional>
+
+// Indexed d-ary min-heap over the items 0..capacity-1.
+// Every item is in the heap at most once, its key can be lowered in place (decrease-key),
+// and the position array makes contains/key lookups O(1).
+// All storage is allocated by the constructor, so the heap never allocates afterwards.
+// Complexity: push, decreaseKey -> O(log_d n), pop -> O(d log_d n)
+template <typename Key, int D = 4, typename Compare = std::less<Key>>
+class IndexedHeap {
+private:
+    std::vector<int> heap; // items in heap order
+    std::vector<int> pos;  // position of every item in heap, -1 if absent
+    std::vector<Key> keys;
+    int count = 0;
+    Compare less;
+
+    void place(int i, int item) {
+        heap[i] = item;
+        pos[item] = i;
+    }
+
+    void siftUp(int i) {
+        int item = heap[i];
+        while (i > 0) {
+            int parent = (i - 1) / D;
+            if (!less(keys[item], keys[heap[parent]])) break;
+            place(i, heap[parent]);
+            i = parent;
+        }
+        place(i, item);
+    }
+
+    void siftDown(int i) {
+        int item = heap[i];
+        while (true) {
+            int first = i * D + 1;
+            if (first >= count) break;
+            int last = first + D < count ? first + D : count;
+            int best = first;
+            for (int c = first + 1; c < last; c++) {
+                if (less(keys[heap[c]], keys[heap[best]])) best = c;
+            }
+            if (!less(keys[heap[best]], keys[item])) break;
+            place(i, heap[best]);
+            i = best;
+        }
+        place(i, item);
+    }
+
+public:
+    explicit IndexedHeap(int capacity) : heap(capacity), pos(capacity, -1), keys(capacity) {
+    }
+
+    bool empty() const { return count == 0; }
+
+    int size() const { return count; }
+
+    bool contains(int item) const { return pos[item] != -1; }
+
+    const Key &key(int item) const { return keys[item]; }
+
+    // Insert an item that is not in the heap
+    void push(int item, const Key &key) {
+        keys[item] = key;
+        heap[count] = item;
+        pos[item] = count;
+        siftUp(count++);
+    }
+
+    // Lower the key of an item that is in the heap
+    void decreaseKey(int item, const Key &key) {
+        keys[item] = key;
+        siftUp(pos[item]);
+    }
+
+    // Item with the smallest key
+    int top() const { return heap[0]; }
+
+    // Remove and return the item with the smallest key
+    int pop() {
+        int item = heap[0];
+        pos[item] = -1;
+        if (--count > 0) {
+            heap[0] = heap[count];
+            siftDown(0);
+        }
+        return item;
+    }
+};
+#endif //INDEXEDHEAP_HPP
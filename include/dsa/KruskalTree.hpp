@@ -0,0 +1,47 @@
+#ifndef KRUSKALTREE_HPP
+#define KRUSKALTREE_HPP
+#include "MST.hpp"
+
+// Kruskal reconstruction tree of a spanning forest, for threshold connectivity queries.
+// Every union of Kruskal's sweep is a tree node labelled with the edge weight, above the
+// two components it joins. The tree is kept in its flat form: the vertices in the order of
+// its leaves, where every component that ever existed is a contiguous range, and between
+// two neighbouring vertices the label of their lowest common ancestor, which is the weight
+// of the union that put them together. The LCA label of a range is the largest of those
+// gaps, read from a sparse table:
+// - u and v are connected using only edges of weight <= T iff the gaps between them are <= T
+// - the component of u at threshold T is the widest range around u with all gaps <= T
+// Complexity: build -> O(n log n) time and memory, connected -> O(1), componentSize -> O(log n)
+class KruskalTree {
+public:
+    KruskalTree() = default;
+
+    // Edges (source, target, weight, id) of a spanning forest of n vertices, in nondecreasing
+    // weight order as Kruskal's algorithm accepts them
+    KruskalTree(int n, const std::vector<std::tuple<int, int, int, int>> &edges);
+
+    // Any minimum spanning forest gives the same answers, its edges are sorted first
+    explicit KruskalTree(const MST &forest);
+
+    int getNumVertices() const { return static_cast<int>(pos.size()); }
+
+    // True if u and v are valid vertices joined by a path of edges of weight <= threshold
+    bool connected(int u, int v, int threshold) const;
+
+    // Number of vertices reachable from u over edges of weight <= threshold (u included),
+    // 0 if u is not a valid vertex
+    int componentSize(int u, int threshold) const;
+
+private:
+    // Position of every vertex in the leaf order
+    std::vector<int> pos;
+    // Range [treeBegin, treeEnd) of leaf positions of the tree each position belongs to
+    std::vector<int> treeBegin, treeEnd;
+    // table[k][i]: largest of the gaps [i, i + 2^k), gap i lying between positions i and i + 1
+    std::vector<std::vector<int>> table;
+
+    // Largest gap between positions from < to
+    int maxGap(int from, int to) const;
+};
+
+#endif // KRUSKALTREE_HPP
@@ -0,0 +1,66 @@
+#ifndef LINKCUTTREE_HPP
+#define LINKCUTTREE_HPP
+#include <vector>
+
+// Link-cut tree (Sleator-Tarjan) over a forest of weighted nodes.
+// Every node carries a value and path queries return the node with the largest value
+// on the tree path between two nodes. Weighted edges are modelled as nodes of their own
+// placed between their endpoints, so a path maximum over edge nodes is the heaviest edge.
+// Nodes are numbered from 0, extra nodes can be added and recycled after construction.
+// Complexity: link, cut, connected, pathMax -> O(log n) amortized
+class LinkCutTree {
+public:
+    explicit LinkCutTree(int n = 0, int value = 0);
+
+    // New isolated node with the given value, returns its number
+    int addNode(int value);
+
+    // Recycle an isolated node (all its tree edges must be cut first)
+    void removeNode(int x);
+
+    // Join the trees of x and y with the tree edge x - y (x and y must not be connected)
+    void link(int x, int y);
+
+    // Remove the tree edge x - y (it must exist)
+    void cut(int x, int y);
+
+    bool connected(int x, int y);
+
+    // Node with the largest value on the path x .. y (both ends included), x and y must be connected
+    int pathMax(int x, int y);
+
+    int value(int x) const { return nodes[x + 1].value; }
+
+    void setValue(int x, int value);
+
+private:
+    // Nodes live at index x + 1, index 0 is the null node
+    struct Node {
+        int child[2] = {0, 0};
+        int parent = 0;
+        int value = 0;
+        int best = 0; // node with the largest value in this splay subtree
+        bool flip = false;
+    };
+
+    std::vector<Node> nodes;
+    std::vector<int> freeNodes;
+    std::vector<int> pending; // scratch stack for splay()
+
+    bool isSplayRoot(int x) const;
+
+    void pull(int x);
+
+    void push(int x);
+
+    void rotate(int x);
+
+    void splay(int x);
+
+    void access(int x);
+
+    void makeRoot(int x);
+
+    int findRoot(int x);
+};
+#endif //LINKCUTTREE_HPP
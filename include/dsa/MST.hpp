@@ -11,32 +11,91 @@
 #include <sstream>
 #include <iomanip>
 #include <stdexcept>
+#include <memory>
+#include <mutex>
 
 using edge = std::tuple<int, int, int>;
 
+// A path of the tree: its two endpoints and total weight
+struct TreePath {
+    long long length = 0;
+    int from = -1, to = -1;
+};
+
+// The edges are stored once, as a flat list in insertion order. Everything else is derived
+// from it on first use and shared by the copies of the MST until one of them changes:
+// - a tree CSR (offsets + (neighbor, weight) pairs) for the traversals of the metrics
+// - the std::set and adj_list views, only built if a caller asks for them
+// - the diameter, the average distance and the string form, computed once per MST
 class MST {
 private:
-    std::set<edge> edges;
+    // Views derived from edgeList, each built once even with concurrent readers
+    struct Views {
+        std::once_flag csrOnce, setOnce, adjOnce;
+        std::vector<int> offsets;
+        std::vector<std::pair<int, int>> neighbors;
+        std::set<edge> edges;
+        adj_list adj;
+        // Memoized metrics
+        std::once_flag diameterOnce, averageOnce, textOnce;
+        TreePath diameter;
+        double average = 0.0;
+        std::string text;
+    };
+
+    std::vector<edge> edgeList;
     int totalWeight;
     int numVertices;
-    adj_list mstAdjList;
+    mutable std::shared_ptr<Views> views;
+    // Name of the algorithm that produced this MST (empty if unknown)
+    std::string algorithm;
+
+    // Appends a valid edge without touching the views
+    bool appendEdge(int u, int v, int weight);
+    // Shared views of this MST, created on first use after a change (or a move)
+    Views& derived() const;
+    // derived() with the tree CSR built
+    const Views& treeCSR() const;
+
+    TreePath computeDiameter() const;
+    double computeAverageDistance() const;
+    std::string computeString() const;
 
 public:
-    MST(){}
+    MST() : totalWeight(0), numVertices(0), views(std::make_shared<Views>()) {}
     MST(int vertices);
     MST(const std::vector<std::tuple<int, int, int, int>>& edges, int vertices);
     void addEdge(int u, int v, int weight);
     
     int getTotalWeight() const;
+
+    // Edges (u, v, weight) in the order they were added
+    const std::vector<edge>& getEdgeList() const { return edgeList; }
+
+    int getNumEdges() const { return static_cast<int>(edgeList.size()); }
     
+    // Set view of the edges, built on first use
     const std::set<edge>& getEdges() const;
     
     int getNumVertices() const;
     
+    // Adjacency view (both directions of every edge), built on first use
     const adj_list& getMstAdjList() const;
+
+    const std::string& getAlgorithm() const { return algorithm; }
+
+    void setAlgorithm(const std::string& name) { algorithm = name; }
     
     int findLongestDistance() const;
+
+    // Heaviest path of the tree (of any tree of a forest), with its endpoints.
+    // Negative weights are fine, a single vertex (length 0) is the shortest possible answer.
+    // Complexity: O(n) the first time, memoized after that
+    TreePath findDiameter() const;
     
+    // Mean tree distance over all pairs of vertices in the same tree.
+    // Complexity: O(n), from the subtree sizes (an edge of weight w that splits a tree of C
+    // vertices into s and C - s lies on s * (C - s) paths). Memoized like findDiameter.
     double findAverageDistance() const;
     
     int findShortestPathWithMstEdge(const adj_list& originalGraph, int src, int dest) const;
@@ -46,11 +105,12 @@ public:
     std::string getAverageDistanceAsString() const;
     
     std::string getLongestDistanceAsString() const;
+    // Edge listing of the MST, built once and memoized
     std::string toString() const;
-private:
-    void dfs(int node, int distance, std::vector<bool>& visited, int& maxDist, int& farthestNode) const;
-    
-    std::vector<std::vector<int>> floydWarshall() const;
+
+    // Flat layout of the forest: every tree in DFS preorder (parents before children, each
+    // subtree contiguous), with the parent and the weight of the edge to it (-1 / 0 at the roots)
+    void flatten(std::vector<int>& order, std::vector<int>& parent, std::vector<int>& parentWeight) const;
 };
 
 #endif // MST_HPP
\ No newline at end of file
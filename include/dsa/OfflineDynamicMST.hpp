@@ -0,0 +1,59 @@
+#ifndef OFFLINEDYNAMICMST_HPP
+#define OFFLINEDYNAMICMST_HPP
+#include "CSRGraph.hpp"
+#include "RollbackUnionFind.hpp"
+#include <istream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// One step of an offline script
+struct ScriptOp {
+    enum Kind { Add, Remove, Query } kind;
+    int s = 0, t = 0, w = 0;
+};
+
+// Offline dynamic minimum spanning forest: answers every MST-weight query of a script of
+// edge insertions, removals and weight changes at once, instead of one full MST per query.
+// Every (s, t) pair is one edge slot whose weight changes over time (a missing edge weighs
+// ABSENT_WEIGHT, heavier than any real edge, and never counts towards an answer).
+// Divide and conquer over the modifications: on every time range, the edges that stay in
+// the forest even if all edges modified in the range were the lightest are contracted,
+// and the edges that stay out even if all modified edges were the heaviest are dropped.
+// A range of k modifications is left with O(k) edges, and the contractions are undone
+// with a rollback union find on the way back.
+// Complexity: O((m + q) log^2 (m + q)) for the whole script
+class OfflineDynamicMST {
+public:
+    // Weight of the minimum spanning forest at every Query of ops, for the graph csr with
+    // the Add/Remove steps before the query applied in order (edges are treated as undirected
+    // and identified by their directed (s, t) pair, like the MST algorithms do)
+    static std::vector<long long> run(const CSRGraph &csr, const std::vector<ScriptOp> &ops);
+
+    // Script steps from a token stream: "a <s> <t> <w>", "r <s> <t>" and "q"
+    static std::vector<ScriptOp> parse(std::istream &in);
+
+private:
+    struct Edge {
+        int u, v, slot;
+    };
+
+    std::vector<long long> weights; // current weight of every slot
+    std::vector<std::pair<int, long long>> mods; // (slot, new weight) in script order
+    std::vector<long long> answers; // forest weight after every modification
+    std::vector<unsigned> modifiedIn; // stamp of the last range that modifies a slot
+    unsigned stamp = 0;
+    RollbackUnionFind uf;
+
+    explicit OfflineDynamicMST(int n) : uf(n) {
+    }
+
+    void solve(int l, int r, std::vector<Edge> &edges, long long base);
+
+    std::vector<long long> currentWeights(const std::vector<Edge> &edges) const;
+
+    // Kruskal over edges ordered by key (one entry per edge). Returns the real weight of the
+    // forest, leaves its unions in uf and flags the picked edges in taken if given.
+    long long kruskal(const std::vector<Edge> &edges, const std::vector<long long> &key, std::vector<char> *taken);
+};
+#endif //OFFLINEDYNAMICMST_HPP
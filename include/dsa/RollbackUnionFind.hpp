@@ -0,0 +1,25 @@
+#ifndef ROLLBACK_UNION_FIND_H
+#define ROLLBACK_UNION_FIND_H
+
+#include <vector>
+
+// Union Find (Disjoint Set Union) whose unions can be undone in reverse order.
+// Union by Rank only: without Path Compression every unite changes at most two entries,
+// which are recorded on an undo stack.
+// Complexity: unite -> O( log(n) ), find_parent -> O( log(n) ), rollback -> O(1) per undone unite
+struct RollbackUnionFind
+{
+    RollbackUnionFind(int _n);
+    int find_parent(int node) const;
+    bool unite(int x, int y);
+    // Current position of the undo stack
+    int snapshot() const { return static_cast<int>(history.size()); }
+    // Undo every unite made after the given snapshot
+    void rollback(int snapshot);
+    std::vector<int> parent, rank;
+    // Undo record: the root that was attached, and whether the new root's rank grew
+    std::vector<std::pair<int, bool>> history;
+    int n, cc;
+};
+
+#endif
@@ -0,0 +1,67 @@
+#ifndef TREEINDEX_HPP
+#define TREEINDEX_HPP
+#include "MST.hpp"
+#include <climits>
+
+// Distance reported for vertices that are invalid or in different trees
+#define NO_PATH LLONG_MIN
+// Pairs resolved side by side by distance_batch
+#define TREE_INDEX_BATCH 64
+
+// Lowest common ancestor index of a spanning forest, for constant time tree distances.
+// Every tree is rooted at its first vertex and laid out in DFS preorder. For u != v with
+// u first, the LCA is the shallowest parent among the vertices after u up to v, which
+// is the one with the smallest preorder position: a range minimum answered by a
+// sparse table over the parents' positions.
+// distance(u, v) = dist[u] + dist[v] - 2 * dist[lca], dist being the weight from the root.
+// Bottleneck queries climb from u and v to the LCA by binary lifting, every jump of 2^k
+// levels storing the heaviest edge it passes.
+// Complexity: build -> O(n log n) time and memory, lca / distance -> O(1),
+//             bottleneck -> O(log depth)
+class TreeIndex {
+public:
+    TreeIndex() = default;
+
+    explicit TreeIndex(const MST &forest);
+
+    int getNumVertices() const { return static_cast<int>(pos.size()); }
+
+    // True if u and v are valid vertices of the same tree
+    bool connected(int u, int v) const;
+
+    // Lowest common ancestor of u and v, -1 if they are not connected
+    int lca(int u, int v) const;
+
+    // Weight of the tree path between u and v, NO_PATH if they are not connected
+    long long distance(int u, int v) const;
+
+    // Heaviest edge on the tree path between u and v, which in a minimum spanning forest is
+    // the smallest possible heaviest edge over all graph paths between them.
+    // NO_PATH if they are not connected or u == v (the path has no edge).
+    long long bottleneck(int u, int v) const;
+
+    // distance() of pairs[0..count) into out[0..count). The pairs go through the lookups in
+    // blocks, one stage at a time with software prefetching, so the cache misses of
+    // different pairs overlap.
+    void distance_batch(const std::pair<int, int> *pairs, long long *out, int count) const;
+
+private:
+    // Preorder of the forest and the position of every vertex in it
+    std::vector<int> order, pos;
+    // Root of the tree of every vertex
+    std::vector<int> root;
+    // Weight of the path from the root
+    std::vector<long long> rootDist;
+    // table[k][i]: smallest parent position among order[i .. i + 2^k)
+    std::vector<std::vector<int>> table;
+    // Number of edges from the root
+    std::vector<int> depth;
+    // jump[k][v]: ancestor 2^k levels above v (the root past it),
+    // jumpMax[k][v]: heaviest edge on the way there
+    std::vector<std::vector<int>> jump, jumpMax;
+
+    // Heaviest edge on the steps levels above v
+    int climbMax(int v, int steps) const;
+};
+
+#endif // TREEINDEX_HPP
@@ -0,0 +1,51 @@
+#ifndef WORKERPOOL_HPP
+#define WORKERPOOL_HPP
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fixed pool of worker threads for data-parallel MST kernels.
+// A job runs on every worker at once (the calling thread takes part as worker 0)
+// and run() returns only when all of them are done. Jobs from different callers
+// are serialized, so the pool never oversubscribes the machine.
+class WorkerPool {
+public:
+    explicit WorkerPool(unsigned workers = std::thread::hardware_concurrency());
+
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool &) = delete;
+
+    WorkerPool &operator=(const WorkerPool &) = delete;
+
+    // Number of workers, including the calling thread
+    unsigned size() const { return workers; }
+
+    // Run task(worker) on every worker and wait for all of them
+    void run(const std::function<void(unsigned)> &task);
+
+    // Split [0, count) into one contiguous chunk per worker and run body(begin, end, worker) on each.
+    // Small ranges are handled by the calling thread alone.
+    void parallelFor(size_t count, const std::function<void(size_t, size_t, unsigned)> &body,
+                     size_t grain = 4096);
+
+    // Process-wide pool sized to the machine
+    static WorkerPool &shared();
+
+private:
+    void loop(unsigned worker);
+
+    unsigned workers;
+    std::vector<std::thread> threads;
+    std::mutex run_mutex; // one job at a time
+    std::mutex mutex;
+    std::condition_variable start_cv;
+    std::condition_variable done_cv;
+    const std::function<void(unsigned)> *task = nullptr;
+    unsigned long generation = 0;
+    unsigned pending = 0;
+    bool stopping = false;
+};
+#endif //WORKERPOOL_HPP
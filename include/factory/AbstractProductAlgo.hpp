@@ -12,7 +12,16 @@ class AbstractProductAlgo : public AbstractProduct {
 
 public:
     AbstractProductAlgo() = default;
-    virtual MST *execute(Graph &graph) = 0;
+
+    // MST edges (source, target, weight, id) of a CSR snapshot
+    virtual vector<tuple<int, int, int, int>> solve(const CSRGraph &csr) = 0;
+
+    // Runs solve() on the CSR snapshot of the graph (shared until the next mutation)
+    virtual MST *execute(Graph &graph) {
+        const CSRGraph &csr = graph.getCSR();
+        return new MST(solve(csr), csr.n);
+    }
+
     ~AbstractProductAlgo() override = default;
 };
 #endif //MSTALGO_HPP
\ No newline at end of file
@@ -6,11 +6,23 @@
 #define CONCRETEALGOFACTORY_HPP
 #define KRUSKAL "kruskal"
 #define PRIM "prim"
+#define BORUVKA "boruvka"
+#define FILTER_KRUSKAL "filter_kruskal"
+#define DENSE_PRIM "dense_prim"
+#define AUTO "auto"
+#define PARALLEL_KRUSKAL "parallel_kruskal"
+#define PRIM_FOREST "prim_forest"
+#define KRUSKAL_FOREST "kruskal_forest"
 #include <map>
 
 #include "AbstractProductAlgo.hpp"
 #include "../dsa/ConcreteAlgoKruskal.hpp"
 #include "../dsa/ConcreteAlgoPrim.hpp"
+#include "../dsa/ConcreteAlgoBoruvka.hpp"
+#include "../dsa/ConcreteAlgoFilterKruskal.hpp"
+#include "../dsa/ConcreteAlgoDensePrim.hpp"
+#include "../dsa/ConcreteAlgoAuto.hpp"
+#include "../dsa/ConcreteAlgoForest.hpp"
 #include "AbstractFactory.hpp"
 
 typedef void (*MSTAlgo)(const vector<tuple<int, int, int, int> > &edges, int n);
@@ -29,6 +41,27 @@ public:
         if (algo == PRIM) {
             return new ConcreteAlgoPrim();
         }
+        if (algo == BORUVKA) {
+            return new ConcreteAlgoBoruvka();
+        }
+        if (algo == FILTER_KRUSKAL) {
+            return new ConcreteAlgoFilterKruskal();
+        }
+        if (algo == DENSE_PRIM) {
+            return new ConcreteAlgoDensePrim();
+        }
+        if (algo == PARALLEL_KRUSKAL) {
+            return new ConcreteAlgoKruskal(KruskalSort::Parallel);
+        }
+        if (algo == PRIM_FOREST) {
+            return new ConcreteAlgoForest(PRIM);
+        }
+        if (algo == KRUSKAL_FOREST) {
+            return new ConcreteAlgoForest(KRUSKAL);
+        }
+        if (algo == AUTO) {
+            return new ConcreteAlgoAuto();
+        }
         return nullptr;
     }
 };
@@ -28,16 +28,19 @@ void MSTPipeline::processCommand(const std::string &input, int client_fd, functi
     if (command == "new_graph") {
         int n;
         iss >> n;
-        proxy->initGraph(n);
 
-        // Process edges if provided
+        // Edges provided inline are loaded as one batch in a single request
         int m;
-        if (iss >> m) {
-            for (int i = 0; i < m; i++) {
-                int u, v, w;
-                iss >> u >> v >> w;
-                proxy->addEdge(u, v, w);
+        if (iss >> m && m > 0) {
+            std::vector<std::tuple<int, int, int>> batch;
+            batch.reserve(m);
+            int u, v, w;
+            for (int i = 0; i < m && iss >> u >> v >> w; i++) {
+                batch.emplace_back(u, v, w);
             }
+            proxy->bulkLoad(n, std::move(batch));
+        } else {
+            proxy->initGraph(n);
         }
 
         callback("New graph created\n");
@@ -51,20 +54,28 @@ void MSTPipeline::processCommand(const std::string &input, int client_fd, functi
         iss >> u >> v;
         proxy->removeEdge(u, v);
         callback("Edge removed\n");
-    } else if (command == "mst_kruskal" || command == "mst_prim") {
-        std::string algo = (command == "mst_kruskal") ? "kruskal" : "prim";
+    } else if (command.rfind("mst_", 0) == 0) {
+        // mst_<algo> - the suffix is the factory id of the algorithm
+        std::string algo = command.substr(4);
+
+        // Unknown ids would leave no MST behind and the metric requests would wait forever
+        std::unique_ptr<AbstractProductAlgo> known(algoFactory.createProduct(algo));
+        if (!known) {
+            callback("Invalid command: " + input + "\n");
+            return;
+        }
 
         // Start a new thread to wait for the Future result
         std::thread([this, proxy, algo, callback]() {
-            Future<MST> result = proxy->computeMST(algo);
+            Future<std::shared_ptr<const MST>> result = proxy->computeMST(algo);
 
             // Wait for MST computation to complete
-            MST mst = result.get();
+            std::shared_ptr<const MST> mst = result.get();
 
             // Calculate MST metrics asynchronously
             Future<int> weightResult = proxy->getWeight();
             Future<int> longestResult = proxy->getLongestDist();
-            Future<int> shortestResult = proxy->getShortestDist(mst.getMstAdjList(), 0, mst.getNumVertices() - 1);
+            Future<int> shortestResult = proxy->getShortestDist(0, mst->getNumVertices() - 1);
             Future<double> avgResult = proxy->getAvgDist();
             Future<std::string> mstStrResult = proxy->toString();
 
@@ -74,10 +85,100 @@ void MSTPipeline::processCommand(const std::string &input, int client_fd, functi
             response += "Longest distance: " + std::to_string(longestResult.get()) + "\n";
             response += "Shortest distance: " + std::to_string(shortestResult.get()) + "\n";
             response += "Average distance: " + std::to_string(avgResult.get()) + "\n";
+            if (algo == "auto") {
+                // Report the choice so it can be audited
+                response += "Algorithm: " + mst->getAlgorithm() + " (auto)\n";
+            }
 
             // Send response back to client
             callback(response);
         }).detach();
+    } else if (command == "run_script") {
+        std::vector<ScriptOp> ops = OfflineDynamicMST::parse(iss);
+
+        // Wait for the answers in a thread of its own, like the MST commands
+        std::thread([proxy, ops = std::move(ops), callback]() mutable {
+            Future<std::vector<long long>> result = proxy->runScript(std::move(ops));
+            std::vector<long long> weights = result.get();
+
+            std::string response = "Script results (" + std::to_string(weights.size()) + " queries):\n";
+            for (size_t i = 0; i < weights.size(); i++) {
+                response += "Query " + std::to_string(i + 1) + ": total weight " + std::to_string(weights[i]) + "\n";
+            }
+            callback(response);
+        }).detach();
+    } else if (command == "distance") {
+        int u, v;
+        iss >> u >> v;
+
+        std::thread([proxy, u, v, callback]() {
+            Future<long long> result = proxy->getDistance(u, v);
+            long long distance = result.get();
+            if (distance == NO_PATH) {
+                callback("No path between " + std::to_string(u) + " and " + std::to_string(v) + " in the MST\n");
+            } else {
+                callback("Distance between " + std::to_string(u) + " and " + std::to_string(v) + ": " +
+                         std::to_string(distance) + "\n");
+            }
+        }).detach();
+    } else if (command == "distances") {
+        // distances <k> followed by k vertex pairs, answered in one request and one response
+        int k = 0;
+        iss >> k;
+        std::vector<std::pair<int, int>> pairs;
+        pairs.reserve(std::max(k, 0));
+        int u, v;
+        for (int i = 0; i < k && iss >> u >> v; i++) {
+            pairs.emplace_back(u, v);
+        }
+
+        std::thread([proxy, pairs = std::move(pairs), callback]() mutable {
+            Future<std::vector<long long>> result = proxy->getDistances(std::vector<std::pair<int, int>>(pairs));
+            std::vector<long long> distances = result.get();
+
+            std::string response = "Distances (" + std::to_string(distances.size()) + " pairs):\n";
+            response.reserve(response.size() + distances.size() * 24);
+            for (size_t i = 0; i < distances.size(); i++) {
+                response += std::to_string(pairs[i].first) + " " + std::to_string(pairs[i].second) + ": ";
+                response += distances[i] == NO_PATH ? "no path" : std::to_string(distances[i]);
+                response += "\n";
+            }
+            callback(response);
+        }).detach();
+    } else if (command == "bottleneck") {
+        int u, v;
+        iss >> u >> v;
+
+        std::thread([proxy, u, v, callback]() {
+            Future<long long> result = proxy->getBottleneck(u, v);
+            long long weight = result.get();
+            if (weight == NO_PATH) {
+                callback("No MST edge between " + std::to_string(u) + " and " + std::to_string(v) + "\n");
+            } else {
+                callback("Bottleneck between " + std::to_string(u) + " and " + std::to_string(v) + ": " +
+                         std::to_string(weight) + "\n");
+            }
+        }).detach();
+    } else if (command == "connected") {
+        int u, v, threshold;
+        iss >> u >> v >> threshold;
+
+        std::thread([proxy, u, v, threshold, callback]() {
+            Future<bool> result = proxy->isConnected(u, v, threshold);
+            bool connected = result.get();
+            callback(std::to_string(u) + " and " + std::to_string(v) + (connected ? " are" : " are not") +
+                     " connected with edges of weight <= " + std::to_string(threshold) + "\n");
+        }).detach();
+    } else if (command == "component_size") {
+        int u, threshold;
+        iss >> u >> threshold;
+
+        std::thread([proxy, u, threshold, callback]() {
+            Future<int> result = proxy->getComponentSize(u, threshold);
+            int size = result.get();
+            callback("Component of " + std::to_string(u) + " with edges of weight <= " + std::to_string(threshold) +
+                     ": " + std::to_string(size) + " vertices\n");
+        }).detach();
     } else if (command == "print_graph") {
         // Get string representation asynchronously
         std::thread([proxy, callback]() {
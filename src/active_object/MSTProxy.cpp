@@ -5,6 +5,11 @@ void MSTProxy::initGraph(int n) {
     scheduler->enqueue(request);
 }
 
+void MSTProxy::bulkLoad(int n, std::vector<std::tuple<int, int, int>> &&batch) {
+    MethodRequest *request = new BulkLoadRequest(servant, n, std::move(batch));
+    scheduler->enqueue(request);
+}
+
 void MSTProxy::addEdge(int u, int v, int w) {
     MethodRequest *request = new AddEdgeRequest(servant, u, v, w);
     scheduler->enqueue(request);
@@ -15,13 +20,20 @@ void MSTProxy::removeEdge(int u, int v) {
     scheduler->enqueue(request);
 }
 
-Future<MST> MSTProxy::computeMST(const std::string &algorithm) {
-    Future<MST> result;
+Future<std::shared_ptr<const MST>> MSTProxy::computeMST(const std::string &algorithm) {
+    Future<std::shared_ptr<const MST>> result;
     MethodRequest *request = new GetMSTRequest(servant, algorithm, &result);
     scheduler->enqueue(request);
     return result;
 }
 
+Future<std::vector<long long>> MSTProxy::runScript(std::vector<ScriptOp> &&ops) {
+    Future<std::vector<long long>> result;
+    MethodRequest *request = new RunScriptRequest(servant, std::move(ops), &result);
+    scheduler->enqueue(request);
+    return result;
+}
+
 Future<int> MSTProxy::getWeight() {
     Future<int> result;
     MethodRequest *request = new GetWeightRequest(servant, &result);
@@ -36,9 +48,44 @@ Future<int> MSTProxy::getLongestDist() {
     return result;
 }
 
-Future<int> MSTProxy::getShortestDist(const adj_list &originalGraph, int src, int dest) {
+Future<int> MSTProxy::getShortestDist(int src, int dest) {
+    Future<int> result;
+    MethodRequest *request = new GetShortestDistRequest(servant, &result, src, dest);
+    scheduler->enqueue(request);
+    return result;
+}
+
+Future<long long> MSTProxy::getDistance(int u, int v) {
+    Future<long long> result;
+    MethodRequest *request = new GetDistanceRequest(servant, &result, u, v);
+    scheduler->enqueue(request);
+    return result;
+}
+
+Future<std::vector<long long>> MSTProxy::getDistances(std::vector<std::pair<int, int>> &&pairs) {
+    Future<std::vector<long long>> result;
+    MethodRequest *request = new GetDistancesRequest(servant, std::move(pairs), &result);
+    scheduler->enqueue(request);
+    return result;
+}
+
+Future<long long> MSTProxy::getBottleneck(int u, int v) {
+    Future<long long> result;
+    MethodRequest *request = new GetBottleneckRequest(servant, &result, u, v);
+    scheduler->enqueue(request);
+    return result;
+}
+
+Future<bool> MSTProxy::isConnected(int u, int v, int threshold) {
+    Future<bool> result;
+    MethodRequest *request = new IsConnectedRequest(servant, &result, u, v, threshold);
+    scheduler->enqueue(request);
+    return result;
+}
+
+Future<int> MSTProxy::getComponentSize(int u, int threshold) {
     Future<int> result;
-    MethodRequest *request = new GetShortestDistRequest(servant, &result, originalGraph, src, dest);
+    MethodRequest *request = new GetComponentSizeRequest(servant, &result, u, threshold);
     scheduler->enqueue(request);
     return result;
 }
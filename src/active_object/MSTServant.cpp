@@ -5,27 +5,74 @@
 void MSTServant::initGraph_i(int n) {
     graph = Graph(n);
     // Reset MST when graph is reinitialized
-    mst = MST();
+    mst = std::make_shared<const MST>();
+    index = TreeIndex();
+    thresholds = KruskalTree();
+    // An empty graph has an empty forest, later insertions keep it up to date
+    dynamic = DynamicMST(n);
+    dynamicValid = true;
+}
+
+void MSTServant::bulkLoad_i(int n, std::vector<std::tuple<int, int, int>> batch) {
+    graph = Graph(n, std::move(batch));
+    // Reset MST when graph is reinitialized
+    mst = std::make_shared<const MST>();
+    index = TreeIndex();
+    thresholds = KruskalTree();
+    // The next full computation seeds the forest
+    dynamic = DynamicMST();
+    dynamicValid = false;
 }
 
 void MSTServant::addEdge_i(int u, int v, int w) {
     graph.addEdge(u, v, w);
+    if (dynamicValid) {
+        dynamic.addEdge(u, v, w);
+    }
 }
 
 void MSTServant::removeEdge_i(int u, int v) {
     graph.removeEdge(u, v);
+    if (dynamicValid) {
+        dynamic.removeEdge(u, v);
+    }
 }
 
-MST MSTServant::getMST_i(const std::string& algo) {
+std::shared_ptr<const MST> MSTServant::getMST_i(const std::string& algo) {
+    // Nothing changed since the same request
+    if (mstEpoch == graph.getEpoch() && mstAlgo == algo) {
+        return mst;
+    }
+
+    // Serve the maintained forest if it is what the algorithm would compute
+    if (dynamicValid && isForestResult(algo, dynamic.getNumEdges())) {
+        auto forest = std::make_shared<MST>(dynamic.toMST());
+        forest->setAlgorithm(INCREMENTAL);
+        setMST(std::move(forest));
+        mstAlgo = algo;
+        mstEpoch = graph.getEpoch();
+        return mst;
+    }
+
     // Get correct algorithm implementation from factory
     AbstractProductAlgo* algorithm = algo_factory.createProduct(algo);
 
     if (algorithm) {
-        // Execute MST algorithm
-        MST* mst_ptr = algorithm->execute(graph);
-        if (mst_ptr) {
-            mst = *mst_ptr;
-            delete mst_ptr;
+        // Execute MST algorithm, the result is owned (never copied) from here on
+        std::shared_ptr<MST> result(algorithm->execute(graph));
+        if (result) {
+            if (result->getAlgorithm().empty()) {
+                result->setAlgorithm(algo);
+            }
+            setMST(std::move(result));
+            mstAlgo = algo;
+            mstEpoch = graph.getEpoch();
+
+            // Seed the maintained forest from a full spanning forest
+            if (!dynamicValid && isForestResult(mst->getAlgorithm(), mst->getNumEdges())) {
+                dynamic = DynamicMST(graph.getCSR(), *mst);
+                dynamicValid = true;
+            }
         }
         delete algorithm;
     }
@@ -33,23 +80,81 @@ MST MSTServant::getMST_i(const std::string& algo) {
     return mst;
 }
 
+void MSTServant::setMST(std::shared_ptr<const MST> result) {
+    mst = std::move(result);
+    index = TreeIndex(*mst);
+    thresholds = KruskalTree(*mst);
+}
+
+std::vector<long long> MSTServant::runScript_i(const std::vector<ScriptOp>& ops) {
+    std::vector<long long> answers = OfflineDynamicMST::run(graph.getCSR(), ops);
+
+    // Leave the graph as the script left it
+    for (const ScriptOp& op : ops) {
+        if (op.kind == ScriptOp::Add) {
+            graph.addEdge(op.s, op.t, op.w);
+        } else if (op.kind == ScriptOp::Remove) {
+            graph.removeEdge(op.s, op.t);
+        }
+    }
+    // The next full computation seeds the forest again
+    dynamic = DynamicMST();
+    dynamicValid = false;
+
+    return answers;
+}
+
+bool MSTServant::isForestResult(const std::string& algo, int treeEdges) {
+    if (algo != PRIM && algo != DENSE_PRIM) {
+        return true;
+    }
+    return treeEdges == graph.getVertices() - 1 && graph.isUndirected();
+}
+
 int MSTServant::getWeight_i() {
-    return mst.getTotalWeight();
+    return mst->getTotalWeight();
 }
 
 int MSTServant::getLongestDist_i() {
-    return mst.findLongestDistance();
+    return mst->findLongestDistance();
+}
+
+int MSTServant::getShortestDist_i(int src, int dest) {
+    long long distance = index.distance(src, dest);
+    return distance == NO_PATH ? -1 : static_cast<int>(distance);
+}
+
+long long MSTServant::getDistance_i(int u, int v) {
+    return index.distance(u, v);
 }
 
-int MSTServant::getShortestDist_i(const adj_list &original_graph, int src, int dest) {
-    return mst.findShortestPathWithMstEdge(original_graph, src, dest);
+std::vector<long long> MSTServant::getDistances_i(const std::vector<std::pair<int, int>>& pairs) {
+    std::vector<long long> distances(pairs.size());
+    index.distance_batch(pairs.data(), distances.data(), static_cast<int>(pairs.size()));
+    return distances;
+}
+
+long long MSTServant::getBottleneck_i(int u, int v) {
+    return index.bottleneck(u, v);
+}
+
+bool MSTServant::isConnected_i(int u, int v, int threshold) {
+    return thresholds.connected(u, v, threshold);
+}
+
+int MSTServant::getComponentSize_i(int u, int threshold) {
+    return thresholds.componentSize(u, threshold);
 }
 
 double MSTServant::getAvgDist_i() {
-    return mst.findAverageDistance();
+    return mst->findAverageDistance();
 }
 
 std::string MSTServant::toString_i() {
+    if (graphTextEpoch == graph.getEpoch()) {
+        return graphText;
+    }
+
     std::stringstream ss;
 
     // Print graph information
@@ -67,7 +172,9 @@ std::string MSTServant::toString_i() {
         }
     }
 
-    return ss.str();
+    graphText = ss.str();
+    graphTextEpoch = graph.getEpoch();
+    return graphText;
 }
 
 bool MSTServant::isGraphInitialized_i() const {
@@ -75,5 +182,5 @@ bool MSTServant::isGraphInitialized_i() const {
 }
 
 bool MSTServant::hasMST_i() const {
-    return mst.getNumVertices() > 0;
+    return mst->getNumVertices() > 0;
 }
\ No newline at end of file
@@ -0,0 +1,30 @@
+#include "../../include/dsa/CSRGraph.hpp"
+
+CSRGraph::CSRGraph(const std::vector<std::vector<std::pair<int, int>>> &adj) {
+    n = static_cast<int>(adj.size());
+
+    // Prefix sums of the out-degrees give the row boundaries
+    offsets.resize(n + 1);
+    offsets[0] = 0;
+    for (int u = 0; u < n; u++) {
+        offsets[u + 1] = offsets[u] + static_cast<int>(adj[u].size());
+    }
+    m = offsets[n];
+
+    sources.resize(m);
+    targets.resize(m);
+    weights.resize(m);
+    ids.resize(m);
+
+    // Copy every row into the flat arrays in a single pass
+    for (int u = 0; u < n; u++) {
+        int k = offsets[u];
+        for (const auto &edge : adj[u]) {
+            sources[k] = u;
+            targets[k] = edge.first;
+            weights[k] = edge.second;
+            ids[k] = k;
+            k++;
+        }
+    }
+}
@@ -0,0 +1,198 @@
+#include "../../include/dsa/ConcreteAlgoAuto.hpp"
+#include "../../include/factory/ConcreteAlgoFactory.hpp"
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <random>
+#include "../../include/dsa/EdgeSort.hpp"
+
+const std::vector<AlgoCandidate> &ConcreteAlgoAuto::candidates() {
+    static const std::vector<AlgoCandidate> list = {
+        {KRUSKAL, [](const GraphFeatures &f) {
+            // One counting pass for small ranges, otherwise one pass per radix digit
+            double passes = f.weightRange < COUNTING_SORT_MAX_RANGE ? 1 : std::ceil(std::log2(f.weightRange + 2) / RADIX_BITS);
+            return f.m * (1 + passes);
+        }, false},
+        {PARALLEL_KRUSKAL, [](const GraphFeatures &f) {
+            double passes = std::ceil(std::log2(f.weightRange + 2) / RADIX_BITS);
+            return f.m * (1 + passes / f.cores);
+        }, false},
+        {FILTER_KRUSKAL, [](const GraphFeatures &f) {
+            return f.m + f.n * std::log2(f.n + 2) * std::log2(f.m / (f.n + 1) + 2);
+        }, false},
+        {BORUVKA, [](const GraphFeatures &f) { return f.m * std::log2(f.n + 2) / f.cores; }, false},
+        {PRIM, [](const GraphFeatures &f) { return f.m * std::log2(f.n + 2); }, true},
+        {DENSE_PRIM, [](const GraphFeatures &f) { return f.n * f.n + f.m; }, true},
+    };
+    return list;
+}
+
+GraphFeatures ConcreteAlgoAuto::features(const CSRGraph &csr) {
+    GraphFeatures f;
+    f.n = csr.n;
+    f.m = csr.m;
+    f.cores = WorkerPool::shared().size();
+    if (csr.m > 0) {
+        auto [lo, hi] = minmax_element(csr.weights.begin(), csr.weights.end());
+        f.weightRange = static_cast<double>(*hi) - static_cast<double>(*lo);
+    }
+    return f;
+}
+
+// Random connected undirected graph: a path through all vertices plus random chords
+static Graph calibrationGraph(int n, long chords, std::mt19937 &rng) {
+    std::vector<std::tuple<int, int, int>> batch;
+    batch.reserve(2 * (n + chords));
+    auto add = [&](int u, int v) {
+        int w = static_cast<int>(rng() % 65536);
+        batch.emplace_back(u, v, w);
+        batch.emplace_back(v, u, w);
+    };
+    for (int v = 1; v < n; v++) {
+        add(v - 1, v);
+    }
+    for (long i = 0; i < chords; i++) {
+        add(static_cast<int>(rng() % n), static_cast<int>(rng() % n));
+    }
+    return Graph(n, std::move(batch));
+}
+
+static std::vector<Graph> calibrationGraphs() {
+    std::mt19937 rng(2025);
+    std::vector<Graph> graphs;
+    graphs.push_back(calibrationGraph(4000, 32000, rng)); // sparse
+    graphs.push_back(calibrationGraph(800, 160000, rng)); // dense
+    return graphs;
+}
+
+// Geometric mean of seconds per unit of predicted work over the calibration graphs,
+// best of two runs on each
+static double measure(const AlgoCandidate &candidate, const std::function<AbstractProductAlgo *()> &create,
+                      std::vector<Graph> &graphs) {
+    double logSum = 0;
+    for (Graph &graph : graphs) {
+        const GraphFeatures f = ConcreteAlgoAuto::features(graph.getCSR());
+        double best = std::numeric_limits<double>::max();
+        for (int rep = 0; rep < 2; rep++) {
+            AbstractProductAlgo *algo = create();
+            auto start = std::chrono::steady_clock::now();
+            MST *mst = algo->execute(graph);
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            delete mst;
+            delete algo;
+            best = std::min(best, elapsed.count());
+        }
+        logSum += std::log(std::max(best, 1e-9) / candidate.work(f));
+    }
+    return std::exp(logSum / graphs.size());
+}
+
+static const AlgoCandidate &candidate(const std::string &id) {
+    const auto &list = ConcreteAlgoAuto::candidates();
+    return *find_if(list.begin(), list.end(), [&id](const AlgoCandidate &c) { return c.id == id; });
+}
+
+// Set once primCoefficients() holds measured values
+static std::atomic<bool> primCalibrated{false};
+
+const std::pair<double, double> &ConcreteAlgoAuto::primCoefficients() {
+    // Runs once per process on first use. Both variants are serial, so Prim can ask for its
+    // density switch even inside pool jobs (forest mode).
+    static const std::pair<double, double> calibrated = [] {
+        std::vector<Graph> graphs = calibrationGraphs();
+        // The heap variant on its own, without its switch to the dense one
+        double heap = measure(candidate(PRIM), [] { return new ConcreteAlgoPrim(false); }, graphs);
+        double dense = measure(candidate(DENSE_PRIM), [] { return new ConcreteAlgoDensePrim(); }, graphs);
+        primCalibrated.store(true, std::memory_order_release);
+        return std::make_pair(heap, dense);
+    }();
+    return calibrated;
+}
+
+const std::vector<double> &ConcreteAlgoAuto::coefficients() {
+    // Built-in benchmark, runs once per process on first use
+    static const std::vector<double> calibrated = [] {
+        std::vector<Graph> graphs = calibrationGraphs();
+        ConcreteAlgoFactory factory;
+        std::vector<double> result;
+        for (const auto &c : candidates()) {
+            if (c.id == PRIM) {
+                result.push_back(primCoefficients().first);
+            } else if (c.id == DENSE_PRIM) {
+                result.push_back(primCoefficients().second);
+            } else {
+                result.push_back(measure(c, [&] { return factory.createProduct(c.id); }, graphs));
+            }
+        }
+        return result;
+    }();
+    return calibrated;
+}
+
+void ConcreteAlgoAuto::calibrate() {
+    coefficients();
+}
+
+bool ConcreteAlgoAuto::densePrimFaster(int n, int m) {
+    // Plain Prim requests must not pay for the benchmark, they keep the heap until it has run
+    if (!primCalibrated.load(std::memory_order_acquire)) return false;
+    GraphFeatures f;
+    f.n = n;
+    f.m = m;
+    const auto &coef = primCoefficients();
+    return coef.second * candidate(DENSE_PRIM).work(f) < coef.first * candidate(PRIM).work(f);
+}
+
+std::string ConcreteAlgoAuto::choose(const GraphFeatures &features, bool allowPrim) {
+    const auto &list = candidates();
+    const auto &coef = coefficients();
+    std::string best = KRUSKAL;
+    double bestCost = std::numeric_limits<double>::max();
+    for (size_t i = 0; i < list.size(); i++) {
+        if (list[i].prim && !allowPrim) continue;
+        double cost = coef[i] * list[i].work(features);
+        if (cost < bestCost) {
+            bestCost = cost;
+            best = list[i].id;
+        }
+    }
+    return best;
+}
+
+// Whether a tree grown from vertex 0 reaches every vertex (edges taken as undirected)
+static bool isConnected(const CSRGraph &csr) {
+    UnionFind uf(csr.n);
+    for (int k = 0; k < csr.m && uf.cc > 1; k++) {
+        uf.unite(csr.sources[k], csr.targets[k]);
+    }
+    return uf.cc <= 1;
+}
+
+MST *ConcreteAlgoAuto::execute(Graph &graph) {
+    const CSRGraph &csr = graph.getCSR();
+    GraphFeatures f = features(csr);
+
+    chosen = choose(f, true);
+    // Prim only agrees with Kruskal on symmetric connected graphs, otherwise pick again without it
+    if (candidate(chosen).prim && !(graph.isUndirected() && isConnected(csr))) {
+        chosen = choose(f, false);
+    }
+
+    ConcreteAlgoFactory factory;
+    AbstractProductAlgo *algo = factory.createProduct(chosen);
+    MST *mst = algo->execute(graph);
+    delete algo;
+    mst->setAlgorithm(chosen);
+    return mst;
+}
+
+vector<tuple<int, int, int, int>> ConcreteAlgoAuto::solve(const CSRGraph &csr) {
+    chosen = choose(features(csr), false);
+
+    ConcreteAlgoFactory factory;
+    AbstractProductAlgo *algo = factory.createProduct(chosen);
+    vector<tuple<int, int, int, int>> edges = algo->solve(csr);
+    delete algo;
+    return edges;
+}
@@ -0,0 +1,103 @@
+#include "../../include/dsa/ConcreteAlgoBoruvka.hpp"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+// Orders edges by (weight, position) in a single 64-bit word so the lightest
+// edge of a component can be kept with one atomic min
+static uint64_t edgeKey(int weight, int k) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(weight) ^ 0x80000000u) << 32) | static_cast<uint32_t>(k);
+}
+
+static void atomicMin(std::atomic<uint64_t> &slot, uint64_t key) {
+    uint64_t current = slot.load(std::memory_order_relaxed);
+    while (key < current && !slot.compare_exchange_weak(current, key, std::memory_order_relaxed)) {
+    }
+}
+
+vector<tuple<int, int, int, int>> ConcreteAlgoBoruvka::boruvka(const CSRGraph &csr) {
+    vector<tuple<int, int, int, int>> result;
+    const int n = csr.n;
+    const uint64_t NONE = UINT64_MAX;
+
+    ConcurrentUnionFind uf(n);
+    // comp[v] - representative of v's component for the current round
+    vector<int> comp(n);
+    for (int v = 0; v < n; v++) {
+        comp[v] = v;
+    }
+    std::unique_ptr<std::atomic<uint64_t>[]> best(new std::atomic<uint64_t>[n]);
+
+    // Edges that still cross two components (self loops never do)
+    vector<int> active;
+    active.reserve(csr.m);
+    for (int k = 0; k < csr.m; k++) {
+        if (csr.sources[k] != csr.targets[k]) {
+            active.push_back(k);
+        }
+    }
+    vector<vector<int>> survivors(pool.size());
+    vector<vector<tuple<int, int, int, int>>> picked(pool.size());
+
+    while (!active.empty()) {
+        pool.parallelFor(n, [&](size_t begin, size_t end, unsigned) {
+            for (size_t v = begin; v < end; v++) {
+                best[v].store(NONE, std::memory_order_relaxed);
+            }
+        });
+
+        // Lightest edge leaving every component
+        pool.parallelFor(active.size(), [&](size_t begin, size_t end, unsigned) {
+            for (size_t i = begin; i < end; i++) {
+                int k = active[i];
+                uint64_t key = edgeKey(csr.weights[k], k);
+                atomicMin(best[comp[csr.sources[k]]], key);
+                atomicMin(best[comp[csr.targets[k]]], key);
+            }
+        });
+
+        // Contract the picked edges. Two components may pick the same edge, the union find drops the repeat.
+        pool.parallelFor(n, [&](size_t begin, size_t end, unsigned worker) {
+            for (size_t c = begin; c < end; c++) {
+                uint64_t key = best[c].load(std::memory_order_relaxed);
+                if (comp[c] != static_cast<int>(c) || key == NONE) continue;
+                int k = static_cast<int>(key & 0xffffffffu);
+                if (uf.unite(csr.sources[k], csr.targets[k])) {
+                    picked[worker].emplace_back(csr.sources[k], csr.targets[k], csr.weights[k], csr.ids[k]);
+                }
+            }
+        });
+        bool merged = false;
+        for (auto &local : picked) {
+            merged |= !local.empty();
+            result.insert(result.end(), local.begin(), local.end());
+            local.clear();
+        }
+        if (!merged || uf.components() == 1) break;
+
+        pool.parallelFor(n, [&](size_t begin, size_t end, unsigned) {
+            for (size_t v = begin; v < end; v++) {
+                comp[v] = uf.find_parent(static_cast<int>(v));
+            }
+        });
+
+        // Keep only the edges that still connect two different components
+        pool.parallelFor(active.size(), [&](size_t begin, size_t end, unsigned worker) {
+            vector<int> &local = survivors[worker];
+            local.clear();
+            for (size_t i = begin; i < end; i++) {
+                int k = active[i];
+                if (comp[csr.sources[k]] != comp[csr.targets[k]]) {
+                    local.push_back(active[i]);
+                }
+            }
+        });
+        active.clear();
+        for (auto &local : survivors) {
+            active.insert(active.end(), local.begin(), local.end());
+            local.clear();
+        }
+    }
+
+    return result;
+}
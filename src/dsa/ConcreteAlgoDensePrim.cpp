@@ -0,0 +1,225 @@
+#include "../../include/dsa/ConcreteAlgoDensePrim.hpp"
+#include "../../include/dsa/ConcreteAlgoAuto.hpp"
+#include <climits>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define DENSE_PRIM_X86
+#endif
+
+// key[v]  - weight of the lightest edge from the tree to v, INT_MAX once v is selected
+// dist[v] - the same weight for relaxing, INT_MIN once v is selected so no edge can beat it
+// via[v]  - CSR position of that edge, -1 while v has not been reached
+// An edge of weight INT_MAX leaves the key where it was, so reaching a vertex is told apart by via.
+
+// Whether an edge of weight w is lighter than what t has, or the first one to reach it
+static inline bool improves(int w, int t, const int *dist, const int *via) {
+    return w < dist[t] || (via[t] < 0 && dist[t] != INT_MIN);
+}
+
+static int argminScalar(const int *key, int from, int n, int best) {
+    for (int i = from; i < n; i++) {
+        if (key[i] < key[best]) best = i;
+    }
+    return best;
+}
+
+static void relaxScalar(const CSRGraph &csr, int from, int to, int *dist, int *key, int *via) {
+    for (int k = from; k < to; k++) {
+        int t = csr.targets[k];
+        int w = csr.weights[k];
+        if (improves(w, t, dist, via)) {
+            dist[t] = w;
+            key[t] = w;
+            via[t] = k;
+        }
+    }
+}
+
+#ifdef DENSE_PRIM_X86
+__attribute__((target("avx2")))
+static int argminAVX2(const int *key, int n) {
+    // Per-lane minimum and the index where it was first seen
+    __m256i best = _mm256_set1_epi32(INT_MAX);
+    __m256i bestIdx = _mm256_setzero_si256();
+    __m256i idx = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i step = _mm256_set1_epi32(8);
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(key + i));
+        __m256i lower = _mm256_cmpgt_epi32(best, v);
+        best = _mm256_blendv_epi8(best, v, lower);
+        bestIdx = _mm256_blendv_epi8(bestIdx, idx, lower);
+        idx = _mm256_add_epi32(idx, step);
+    }
+    alignas(32) int lanes[8], lanesIdx[8];
+    _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), best);
+    _mm256_store_si256(reinterpret_cast<__m256i *>(lanesIdx), bestIdx);
+    int result = 0;
+    for (int l = 0; l < 8; l++) {
+        if (lanes[l] < key[result] || (lanes[l] == key[result] && lanesIdx[l] < result)) {
+            result = lanesIdx[l];
+        }
+    }
+    return argminScalar(key, i, n, result);
+}
+
+__attribute__((target("avx2")))
+static void relaxAVX2(const CSRGraph &csr, int from, int to, int *dist, int *key, int *via) {
+    const int *targets = csr.targets.data();
+    const int *weights = csr.weights.data();
+    const __m256i none = _mm256_set1_epi32(INT_MAX);
+    int k = from;
+    for (; k + 8 <= to; k += 8) {
+        __m256i t = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(targets + k));
+        __m256i w = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(weights + k));
+        __m256i d = _mm256_i32gather_epi32(dist, t, 4);
+        // Lighter edges, plus INT_MAX edges to vertices at INT_MAX that may not be reached yet
+        __m256i heaviest = _mm256_and_si256(_mm256_cmpeq_epi32(w, none), _mm256_cmpeq_epi32(d, none));
+        __m256i candidates = _mm256_or_si256(_mm256_cmpgt_epi32(d, w), heaviest);
+        int hits = _mm256_movemask_ps(_mm256_castsi256_ps(candidates));
+        // Only the improving lanes are written back, re-checked in case a row repeats a target
+        while (hits) {
+            int l = __builtin_ctz(hits);
+            hits &= hits - 1;
+            int v = targets[k + l];
+            if (improves(weights[k + l], v, dist, via)) {
+                dist[v] = weights[k + l];
+                key[v] = weights[k + l];
+                via[v] = k + l;
+            }
+        }
+    }
+    relaxScalar(csr, k, to, dist, key, via);
+}
+
+__attribute__((target("sse4.1")))
+static int argminSSE41(const int *key, int n) {
+    __m128i best = _mm_set1_epi32(INT_MAX);
+    __m128i bestIdx = _mm_setzero_si128();
+    __m128i idx = _mm_setr_epi32(0, 1, 2, 3);
+    const __m128i step = _mm_set1_epi32(4);
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(key + i));
+        __m128i lower = _mm_cmpgt_epi32(best, v);
+        best = _mm_blendv_epi8(best, v, lower);
+        bestIdx = _mm_blendv_epi8(bestIdx, idx, lower);
+        idx = _mm_add_epi32(idx, step);
+    }
+    alignas(16) int lanes[4], lanesIdx[4];
+    _mm_store_si128(reinterpret_cast<__m128i *>(lanes), best);
+    _mm_store_si128(reinterpret_cast<__m128i *>(lanesIdx), bestIdx);
+    int result = 0;
+    for (int l = 0; l < 4; l++) {
+        if (lanes[l] < key[result] || (lanes[l] == key[result] && lanesIdx[l] < result)) {
+            result = lanesIdx[l];
+        }
+    }
+    return argminScalar(key, i, n, result);
+}
+
+__attribute__((target("sse4.1")))
+static void relaxSSE41(const CSRGraph &csr, int from, int to, int *dist, int *key, int *via) {
+    const int *targets = csr.targets.data();
+    const int *weights = csr.weights.data();
+    const __m128i none = _mm_set1_epi32(INT_MAX);
+    int k = from;
+    for (; k + 4 <= to; k += 4) {
+        // No gather before AVX2, the four distances are loaded one by one
+        __m128i d = _mm_setr_epi32(dist[targets[k]], dist[targets[k + 1]],
+                                   dist[targets[k + 2]], dist[targets[k + 3]]);
+        __m128i w = _mm_loadu_si128(reinterpret_cast<const __m128i *>(weights + k));
+        __m128i heaviest = _mm_and_si128(_mm_cmpeq_epi32(w, none), _mm_cmpeq_epi32(d, none));
+        __m128i candidates = _mm_or_si128(_mm_cmpgt_epi32(d, w), heaviest);
+        int hits = _mm_movemask_ps(_mm_castsi128_ps(candidates));
+        while (hits) {
+            int l = __builtin_ctz(hits);
+            hits &= hits - 1;
+            int v = targets[k + l];
+            if (improves(weights[k + l], v, dist, via)) {
+                dist[v] = weights[k + l];
+                key[v] = weights[k + l];
+                via[v] = k + l;
+            }
+        }
+    }
+    relaxScalar(csr, k, to, dist, key, via);
+}
+#endif
+
+enum class SimdLevel { Scalar, SSE41, AVX2 };
+
+static SimdLevel detectSimd() {
+#ifdef DENSE_PRIM_X86
+    if (__builtin_cpu_supports("avx2")) return SimdLevel::AVX2;
+    if (__builtin_cpu_supports("sse4.1")) return SimdLevel::SSE41;
+#endif
+    return SimdLevel::Scalar;
+}
+
+vector<tuple<int, int, int, int>> ConcreteAlgoDensePrim::densePrim(const CSRGraph &csr) {
+    vector<tuple<int, int, int, int>> result;
+    int n = csr.n;
+    if (n == 0) return result;
+    result.reserve(n - 1);
+
+    static const SimdLevel simd = detectSimd();
+
+    vector<int> key(n, INT_MAX), dist(n, INT_MAX), via(n, -1);
+
+    // Start with vertex 0
+    int u = 0;
+    while (true) {
+        key[u] = INT_MAX;
+        dist[u] = INT_MIN;
+
+        // Relax all edges from the new vertex
+        int from = csr.offsets[u], to = csr.offsets[u + 1];
+#ifdef DENSE_PRIM_X86
+        if (simd == SimdLevel::AVX2) {
+            relaxAVX2(csr, from, to, dist.data(), key.data(), via.data());
+        } else if (simd == SimdLevel::SSE41) {
+            relaxSSE41(csr, from, to, dist.data(), key.data(), via.data());
+        } else
+#endif
+        {
+            relaxScalar(csr, from, to, dist.data(), key.data(), via.data());
+        }
+
+        // Nearest vertex outside the tree
+        int next;
+#ifdef DENSE_PRIM_X86
+        if (simd == SimdLevel::AVX2) {
+            next = argminAVX2(key.data(), n);
+        } else if (simd == SimdLevel::SSE41) {
+            next = argminSSE41(key.data(), n);
+        } else
+#endif
+        {
+            next = argminScalar(key.data(), 1, n, 0);
+        }
+
+        // Only INT_MAX keys left: the first vertex reached by an INT_MAX edge, if there is one
+        if (key[next] == INT_MAX) {
+            next = -1;
+            for (int v = 0; v < n; v++) {
+                if (via[v] >= 0 && dist[v] == INT_MAX) {
+                    next = v;
+                    break;
+                }
+            }
+            // Nothing left to reach
+            if (next < 0) break;
+        }
+
+        u = next;
+        int k = via[u];
+        result.emplace_back(csr.sources[k], u, csr.weights[k], csr.ids[k]);
+    }
+    return result;
+}
+
+bool ConcreteAlgoDensePrim::prefers(const CSRGraph &csr) {
+    return csr.n >= DENSE_PRIM_MIN_VERTICES && ConcreteAlgoAuto::densePrimFaster(csr.n, csr.m);
+}
@@ -0,0 +1,69 @@
+#include "../../include/dsa/ConcreteAlgoFilterKruskal.hpp"
+#include <algorithm>
+#include <bit>
+#include <numeric>
+
+vector<tuple<int, int, int, int>> ConcreteAlgoFilterKruskal::filterKruskal(const CSRGraph &csr) {
+    vector<tuple<int, int, int, int>> result;
+    UnionFind uf(csr.n);
+
+    // Edge positions in the CSR, reordered in place by the recursion
+    vector<int> order(csr.m);
+    iota(order.begin(), order.end(), 0);
+
+    // Twice the balanced depth, as in introsort
+    int depth = 2 * static_cast<int>(bit_width(order.size()));
+    filter(csr, order, 0, order.size(), depth, uf, result);
+    return result;
+}
+
+void ConcreteAlgoFilterKruskal::filter(const CSRGraph &csr, vector<int> &order, size_t lo, size_t hi, int depth,
+                                       UnionFind &uf, vector<tuple<int, int, int, int>> &result) {
+    // Early exit: the forest is already a spanning tree
+    if (lo >= hi || uf.cc == 1) return;
+
+    if (hi - lo <= FILTER_KRUSKAL_BASE || depth == 0) {
+        sort(order.begin() + lo, order.begin() + hi,
+             [&csr](int a, int b) { return csr.weights[a] < csr.weights[b]; });
+        sweep(csr, order, lo, hi, uf, result);
+        return;
+    }
+
+    // Median of three as pivot weight
+    int a = csr.weights[order[lo]];
+    int b = csr.weights[order[lo + (hi - lo) / 2]];
+    int c = csr.weights[order[hi - 1]];
+    int pivot = max(min(a, b), min(max(a, b), c));
+
+    // Three-way partition: [lo, eq) lighter, [eq, heavy) equal to the pivot, [heavy, hi) heavier
+    auto first = order.begin();
+    size_t eq = partition(first + lo, first + hi,
+                          [&csr, pivot](int k) { return csr.weights[k] < pivot; }) - first;
+    size_t heavy = partition(first + eq, first + hi,
+                             [&csr, pivot](int k) { return csr.weights[k] == pivot; }) - first;
+
+    filter(csr, order, lo, eq, depth - 1, uf, result);
+    // Edges of equal weight need no sorting among themselves
+    sweep(csr, order, eq, heavy, uf, result);
+    if (uf.cc == 1) return;
+
+    // Filter: drop heavy edges that would close a cycle
+    size_t kept = remove_if(first + heavy, first + hi, [&csr, &uf](int k) {
+        return uf.find_parent(csr.sources[k]) == uf.find_parent(csr.targets[k]);
+    }) - first;
+    filter(csr, order, heavy, kept, depth - 1, uf, result);
+}
+
+void ConcreteAlgoFilterKruskal::sweep(const CSRGraph &csr, const vector<int> &order, size_t lo, size_t hi,
+                                      UnionFind &uf, vector<tuple<int, int, int, int>> &result) {
+    for (size_t i = lo; i < hi && uf.cc > 1; i++) {
+        int k = order[i];
+        int u = csr.sources[k];
+        int v = csr.targets[k];
+
+        // If including this edge doesn't create a cycle, add it to the MST
+        if (uf.unite(u, v)) {
+            result.emplace_back(u, v, csr.weights[k], csr.ids[k]);
+        }
+    }
+}
@@ -0,0 +1,119 @@
+#include "../../include/dsa/ConcreteAlgoForest.hpp"
+#include "../../include/factory/ConcreteAlgoFactory.hpp"
+#include <atomic>
+#include <memory>
+
+vector<tuple<int, int, int, int>> ConcreteAlgoForest::solve(const CSRGraph &csr) {
+    const int n = csr.n;
+
+    // Label the components of the undirected view
+    ConcurrentUnionFind uf(n);
+    pool.parallelFor(csr.m, [&](size_t begin, size_t end, unsigned) {
+        for (size_t k = begin; k < end; k++) {
+            uf.unite(csr.sources[k], csr.targets[k]);
+        }
+    });
+    vector<int> root(n);
+    pool.parallelFor(n, [&](size_t begin, size_t end, unsigned) {
+        for (size_t v = begin; v < end; v++) {
+            root[v] = uf.find_parent(static_cast<int>(v));
+        }
+    });
+
+    // Dense component numbers, and the number of every vertex inside its component
+    vector<int> label(n, -1), local(n), sizes;
+    for (int v = 0; v < n; v++) {
+        int &c = label[root[v]];
+        if (c < 0) {
+            c = static_cast<int>(sizes.size());
+            sizes.push_back(0);
+        }
+        local[v] = sizes[c]++;
+    }
+    const int count = static_cast<int>(sizes.size());
+
+    // Edge positions grouped by component (self loops never belong to a forest)
+    vector<int> start(count + 1, 0);
+    for (int k = 0; k < csr.m; k++) {
+        if (csr.sources[k] != csr.targets[k]) {
+            start[label[root[csr.sources[k]]] + 1]++;
+        }
+    }
+    for (int c = 0; c < count; c++) {
+        start[c + 1] += start[c];
+    }
+    vector<int> grouped(start[count]);
+    vector<int> fill(start.begin(), start.end() - 1);
+    for (int k = 0; k < csr.m; k++) {
+        if (csr.sources[k] != csr.targets[k]) {
+            grouped[fill[label[root[csr.sources[k]]]]++] = k;
+        }
+    }
+
+    // Components that have edges, the largest first so no worker is left with it at the end
+    vector<int> order;
+    for (int c = 0; c < count; c++) {
+        if (start[c + 1] > start[c]) order.push_back(c);
+    }
+    sort(order.begin(), order.end(), [&start](int a, int b) {
+        return start[a + 1] - start[a] > start[b + 1] - start[b];
+    });
+
+    vector<vector<tuple<int, int, int, int>>> found(pool.size());
+    std::atomic<size_t> next{0};
+    pool.run([&](unsigned worker) {
+        ConcreteAlgoFactory factory;
+        std::unique_ptr<AbstractProductAlgo> algo;
+        vector<int> edges;
+        for (size_t i = next++; i < order.size(); i = next++) {
+            if (!algo) algo.reset(factory.createProduct(innerId));
+            int c = order[i];
+            edges.assign(grouped.begin() + start[c], grouped.begin() + start[c + 1]);
+            CSRGraph sub = component(csr, sizes[c], edges, local);
+
+            // Back to the global edges through the ids
+            for (const auto &edge : algo->solve(sub)) {
+                int k = get<3>(edge);
+                found[worker].emplace_back(csr.sources[k], csr.targets[k], csr.weights[k], csr.ids[k]);
+            }
+        }
+    });
+
+    vector<tuple<int, int, int, int>> result;
+    for (auto &part : found) {
+        result.insert(result.end(), part.begin(), part.end());
+    }
+    return result;
+}
+
+CSRGraph ConcreteAlgoForest::component(const CSRGraph &csr, int vertices, const vector<int> &edges,
+                                       const vector<int> &local) {
+    CSRGraph sub;
+    sub.n = vertices;
+    sub.m = 2 * static_cast<int>(edges.size());
+    sub.offsets.assign(vertices + 1, 0);
+    for (int k : edges) {
+        sub.offsets[local[csr.sources[k]] + 1]++;
+        sub.offsets[local[csr.targets[k]] + 1]++;
+    }
+    for (int v = 0; v < vertices; v++) {
+        sub.offsets[v + 1] += sub.offsets[v];
+    }
+
+    sub.sources.resize(sub.m);
+    sub.targets.resize(sub.m);
+    sub.weights.resize(sub.m);
+    sub.ids.resize(sub.m);
+    vector<int> fill(sub.offsets.begin(), sub.offsets.end() - 1);
+    for (int k : edges) {
+        int s = local[csr.sources[k]], t = local[csr.targets[k]];
+        for (auto [from, to] : {make_pair(s, t), make_pair(t, s)}) {
+            int p = fill[from]++;
+            sub.sources[p] = from;
+            sub.targets[p] = to;
+            sub.weights[p] = csr.weights[k];
+            sub.ids[p] = k;
+        }
+    }
+    return sub;
+}
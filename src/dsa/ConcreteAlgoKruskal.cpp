@@ -1,45 +1,63 @@
 #include "../../include/dsa/ConcreteAlgoKruskal.hpp"
+#include "../../include/dsa/EdgeSort.hpp"
 #include <algorithm>
+#include <numeric>
 #include <iostream>
 
-vector<tuple<int, int, int, int>> ConcreteAlgoKruskal::kruskal(
-    const vector<tuple<int, int, int, int>> &graph_edges, int n) {
+vector<tuple<int, int, int, int>> ConcreteAlgoKruskal::kruskal(const CSRGraph &csr) {
     // Initialize result vector for MST edges
     vector<tuple<int, int, int, int>> result;
 
     // Create a UnionFind structure for n vertices
-    UnionFind uf(n);
-
-    // Sort edges by weight
-    vector<tuple<int, int, int, int>> edges = graph_edges;
-    sort(edges.begin(), edges.end(),
-         [](const tuple<int, int, int, int> &a, const tuple<int, int, int, int> &b) {
-             return get<2>(a) < get<2>(b);
-         });
-
-    // Process edges in order of increasing weight
-    for (const auto &edge : edges) {
-        int u = get<0>(edge);
-        int v = get<1>(edge);
-
-        // If including this edge doesn't create a cycle, add it to the MST
-        if (uf.find_parent(u) != uf.find_parent(v)) {
-            uf.unite(u, v);
-            result.push_back(edge);
+    UnionFind uf(csr.n);
+
+    // Sort edge positions by weight instead of moving whole edges around
+    vector<int> order = sortEdges(csr);
+
+    // Process edges in order of increasing weight, one window at a time
+    int ends[2 * KRUSKAL_WINDOW], roots[2 * KRUSKAL_WINDOW];
+    for (size_t base = 0; base < order.size() && uf.cc > 1; base += KRUSKAL_WINDOW) {
+        int count = static_cast<int>(min<size_t>(KRUSKAL_WINDOW, order.size() - base));
+        for (int i = 0; i < count; i++) {
+            int k = order[base + i];
+            ends[2 * i] = csr.sources[k];
+            ends[2 * i + 1] = csr.targets[k];
+        }
+        // The next window's endpoints are random accesses into the CSR too
+        for (size_t i = base + KRUSKAL_WINDOW; i < min(order.size(), base + 2 * KRUSKAL_WINDOW); i++) {
+            __builtin_prefetch(&csr.sources[order[i]]);
+            __builtin_prefetch(&csr.targets[order[i]]);
+        }
+        uf.find_batch(ends, roots, 2 * count);
+
+        for (int i = 0; i < count; i++) {
+            // Endpoints that were connected before the window stay connected
+            if (roots[2 * i] == roots[2 * i + 1]) continue;
+
+            // Earlier edges of the window may have joined them meanwhile, unite checks again
+            if (uf.unite(ends[2 * i], ends[2 * i + 1])) {
+                int k = order[base + i];
+                result.emplace_back(ends[2 * i], ends[2 * i + 1], csr.weights[k], csr.ids[k]);
+            }
         }
     }
 
     return result;
 }
 
-MST* ConcreteAlgoKruskal::execute(Graph &graph) {
-    // Get edge list and vertex count from graph
-    auto [edges, n] = graph.getAsPair();
-
-
-    // Execute Kruskal's algorithm
-    vector<tuple<int, int, int, int>> mst_edges = kruskal(edges, n);
-
-    // Create and return MST object
-    return new MST(mst_edges, n);
-}
\ No newline at end of file
+vector<int> ConcreteAlgoKruskal::sortEdges(const CSRGraph &csr) {
+    switch (mode) {
+        case KruskalSort::Comparison: {
+            vector<int> order(csr.m);
+            iota(order.begin(), order.end(), 0);
+            stable_sort(order.begin(), order.end(),
+                        [&csr](int a, int b) { return csr.weights[a] < csr.weights[b]; });
+            return order;
+        }
+        case KruskalSort::Parallel:
+            return parallelSortEdgesByWeight(csr, pool);
+        case KruskalSort::Integer:
+        default:
+            return sortEdgesByWeight(csr);
+    }
+}
@@ -1,93 +1,55 @@
 #include "../../include/dsa/ConcreteAlgoPrim.hpp"
-#include <iostream>
 #include <vector>
-#include <set>
+#include "../../include/dsa/ConcreteAlgoDensePrim.hpp"
 
-vector<tuple<int, int, int, int> > ConcreteAlgoPrim::_prim(
-    const vector<vector<Edge> > &adj, int n) {
+vector<tuple<int, int, int, int> > ConcreteAlgoPrim::prim(const CSRGraph &csr) {
     vector<tuple<int, int, int, int> > result;
-
-    // Priority queue to find minimum weight edge
-    std::set<Edge> q;
-
+    int n = csr.n;
+    if (n == 0) return result;
+    result.reserve(n - 1);
+
+    // Frontier vertices keyed by the weight of their lightest edge into the tree.
+    // Ties go to the smaller vertex, the same order the dense variant scans in.
+    IndexedHeap<pair<int, int> > heap(n);
+    // CSR position of that edge for every frontier vertex
+    vector<int> via(n, -1);
     // Array to keep track of which vertices are in MST
     vector<bool> selected(n, false);
 
     // Start with vertex 0
-    int src = 0;
-    selected[src] = true;
-
-    // Add all edges from source to priority queue
-    for (const Edge &e: adj[src]) {
-        q.insert(e);
-    }
-    // Process n-1 edges to build MST
-    while (!q.empty() && result.size() < n - 1) {
-        // Get minimum weight edge
-        Edge minEdge = *q.begin();
-        q.erase(q.begin());
-
-        int to = minEdge.to;
-
-        // Skip if destination already in MST
-        if (selected[to]) continue;
-
-        // Add edge to MST
-        int weight = minEdge.w;
-        int id = minEdge.id;
-
-        // Find the source vertex for this edge
-        int from = -1;
-        for (int i = 0; i < n; i++) {
-            if (selected[i]) {
-                for (const Edge &e: adj[i]) {
-                    if (e.to == to && e.w == weight && e.id == id) {
-                        from = i;
-                        break;
-                    }
-                }
-                if (from != -1) break;
+    int u = 0;
+    while (true) {
+        selected[u] = true;
+
+        // Relax all edges from the new vertex
+        for (int k = csr.offsets[u]; k < csr.offsets[u + 1]; k++) {
+            int to = csr.targets[k];
+            if (selected[to]) continue;
+            if (!heap.contains(to)) {
+                heap.push(to, make_pair(csr.weights[k], to));
+                via[to] = k;
+            } else if (csr.weights[k] < heap.key(to).first) {
+                heap.decreaseKey(to, make_pair(csr.weights[k], to));
+                via[to] = k;
             }
         }
 
-        if (from == -1) {
-            std::cerr << "Prim: Error finding source vertex for edge to " << to << std::endl;
-            continue;
-        }
-        result.push_back(make_tuple(from, to, weight, id));
-        selected[to] = true;
+        if (heap.empty()) break;
 
-        // Add all edges from new vertex
-        for (const Edge &e: adj[to]) {
-            if (!selected[e.to]) {
-                q.insert(e);
-            }
-        }
+        // Closest vertex outside the tree, its parent is the source of the edge that reached it
+        u = heap.pop();
+        int k = via[u];
+        result.emplace_back(csr.sources[k], u, csr.weights[k], csr.ids[k]);
     }
     return result;
 }
 
-vector<tuple<int, int, int, int> > ConcreteAlgoPrim::prim(
-    const vector<tuple<int, int, int, int> > &edges, int n) {
-    // Build adjacency list from edge list
-    vector<vector<Edge> > adj(n);
-
-    for (const auto &edge: edges) {
-        int u = get<0>(edge);
-        int v = get<1>(edge);
-        int w = get<2>(edge);
-        int id = get<3>(edge);
-
-        adj[u].push_back(Edge(w, v, id));
+vector<tuple<int, int, int, int> > ConcreteAlgoPrim::solve(const CSRGraph &csr) {
+    // Near-complete graphs are cheaper with the O(n^2) array based variant
+    if (allowDense && ConcreteAlgoDensePrim::prefers(csr)) {
+        ConcreteAlgoDensePrim dense;
+        return dense.solve(csr);
     }
-    return _prim(adj, n);
-}
-
-MST *ConcreteAlgoPrim::execute(Graph &graph) {
-    // Get edge list and vertex count from graph
-    auto [edges, n] = graph.getAsPair();
     // Execute Prim's algorithm
-    vector<tuple<int, int, int, int> > mst_edges = prim(edges, n);
-    // Create and return MST object
-    return new MST(mst_edges, n);
+    return prim(csr);
 }
@@ -0,0 +1,67 @@
+#include "../../include/dsa/ConcurrentUnionFind.hpp"
+#include <utility>
+
+ConcurrentUnionFind::ConcurrentUnionFind(int _n) : parent(_n), n(_n), cc(_n) {
+    // Initialize each element as its own parent
+    for (int i = 0; i < n; i++) {
+        parent[i].store(i, std::memory_order_relaxed);
+    }
+}
+
+int ConcurrentUnionFind::find_parent(int node) {
+    // Path splitting: point every node on the path to its grandparent.
+    // A failed CAS means another thread already moved the pointer up, so it is simply skipped.
+    while (true) {
+        int p = parent[node].load(std::memory_order_acquire);
+        if (p == node) {
+            return node;
+        }
+        int gp = parent[p].load(std::memory_order_acquire);
+        if (p != gp) {
+            parent[node].compare_exchange_weak(p, gp, std::memory_order_release, std::memory_order_relaxed);
+        }
+        node = p;
+    }
+}
+
+bool ConcurrentUnionFind::unite(int x, int y) {
+    while (true) {
+        int root_x = find_parent(x);
+        int root_y = find_parent(y);
+
+        // Already in the same set
+        if (root_x == root_y) {
+            return false;
+        }
+
+        // Link by index: the lower root goes under the higher one
+        if (root_x > root_y) {
+            std::swap(root_x, root_y);
+        }
+        int expected = root_x;
+        if (parent[root_x].compare_exchange_strong(expected, root_y, std::memory_order_acq_rel)) {
+            // Decrease the count of connected components
+            cc.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+        // root_x stopped being a root meanwhile, look the roots up again
+        x = root_x;
+        y = root_y;
+    }
+}
+
+bool ConcurrentUnionFind::same_set(int x, int y) {
+    while (true) {
+        int root_x = find_parent(x);
+        int root_y = find_parent(y);
+        if (root_x == root_y) {
+            return true;
+        }
+        // root_x is still a root, so the two sets were apart when root_y was read
+        if (parent[root_x].load(std::memory_order_acquire) == root_x) {
+            return false;
+        }
+        x = root_x;
+        y = root_y;
+    }
+}
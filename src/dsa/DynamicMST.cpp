@@ -0,0 +1,187 @@
+#include "../../include/dsa/DynamicMST.hpp"
+#include <algorithm>
+#include <climits>
+
+// Vertex nodes get the smallest value so a path maximum is always an edge node
+DynamicMST::DynamicMST(int n) : n(n), tree(n, INT_MIN), edgeAt(n), treeAt(n), incident(n), seen(n, 0) {
+}
+
+DynamicMST::DynamicMST(const CSRGraph &csr, const MST &forest) : DynamicMST(csr.n) {
+    for (int k = 0; k < csr.m; k++) {
+        int s = csr.sources[k], t = csr.targets[k];
+        if (s == t) continue;
+        incident[s][key(s, t)] = csr.weights[k];
+        incident[t][key(s, t)] = csr.weights[k];
+    }
+    for (const auto &[s, t, w] : forest.getEdgeList()) {
+        link(s, t, w);
+    }
+}
+
+void DynamicMST::addEdge(int s, int t, int w) {
+    // Invalid edges never reach the graph and self loops never join two trees
+    if (s < 0 || s >= n || t < 0 || t >= n || s == t) {
+        return;
+    }
+
+    long long k = key(s, t);
+    auto known = incident[s].find(k);
+    if (known == incident[s].end()) {
+        incident[s][k] = w;
+        incident[t][k] = w;
+        insert(s, t, w);
+        return;
+    }
+
+    int old = known->second;
+    known->second = w;
+    incident[t][k] = w;
+
+    auto it = treeEdges.find(k);
+    if (it != treeEdges.end()) {
+        if (w <= old) {
+            // A lighter tree edge stays in the forest
+            TreeEdge &edge = edgeAt[it->second];
+            totalWeight += w - edge.w;
+            edge.w = w;
+            tree.setValue(it->second, w);
+        } else {
+            // A heavier one competes with every other edge across its cut, itself included
+            replace(it->second);
+        }
+    } else if (w < old) {
+        insert(s, t, w);
+    }
+}
+
+void DynamicMST::removeEdge(int s, int t) {
+    if (s < 0 || s >= n || t < 0 || t >= n || s == t) {
+        return;
+    }
+
+    long long k = key(s, t);
+    if (incident[s].erase(k) == 0) {
+        return;
+    }
+    incident[t].erase(k);
+
+    // Removing a non-tree edge leaves the forest minimal
+    auto it = treeEdges.find(k);
+    if (it != treeEdges.end()) {
+        replace(it->second);
+    }
+}
+
+MST DynamicMST::toMST() const {
+    std::vector<std::tuple<int, int, int, int>> edges;
+    edges.reserve(treeEdges.size());
+    for (const auto &[k, node] : treeEdges) {
+        const TreeEdge &edge = edgeAt[node];
+        edges.emplace_back(edge.s, edge.t, edge.w, node);
+    }
+    // The hash map order depends on its history, the result should not
+    std::sort(edges.begin(), edges.end());
+    return MST(edges, n);
+}
+
+void DynamicMST::insert(int s, int t, int w) {
+    if (!tree.connected(s, t)) {
+        link(s, t, w);
+        return;
+    }
+
+    // Cycle property: the new edge replaces the heaviest edge on the tree path if it is lighter
+    int heaviest = tree.pathMax(s, t);
+    if (tree.value(heaviest) > w) {
+        cut(heaviest);
+        link(s, t, w);
+    }
+}
+
+void DynamicMST::link(int s, int t, int w) {
+    int node = tree.addNode(w);
+    if (node >= static_cast<int>(edgeAt.size())) {
+        edgeAt.resize(node + 1);
+    }
+    edgeAt[node] = {s, t, w};
+    treeEdges[key(s, t)] = node;
+    treeAt[s].push_back(node);
+    treeAt[t].push_back(node);
+    tree.link(s, node);
+    tree.link(node, t);
+    totalWeight += w;
+}
+
+void DynamicMST::replace(int node) {
+    int a = edgeAt[node].s, b = edgeAt[node].t;
+    cut(node);
+
+    // Walk both halves one vertex at a time until the smaller one is exhausted
+    stamp += 2;
+    if (stamp < 2) {
+        // Wrapped around, clear the old stamps
+        std::fill(seen.begin(), seen.end(), 0);
+        stamp = 2;
+    }
+    sides[0].assign(1, a);
+    sides[1].assign(1, b);
+    seen[a] = stamp;
+    seen[b] = stamp + 1;
+    size_t next[2] = {0, 0};
+    int small = -1;
+    while (small < 0) {
+        for (int side = 0; side < 2 && small < 0; side++) {
+            if (next[side] == sides[side].size()) {
+                small = side;
+                break;
+            }
+            int v = sides[side][next[side]++];
+            for (int e : treeAt[v]) {
+                int u = edgeAt[e].s == v ? edgeAt[e].t : edgeAt[e].s;
+                if (seen[u] != stamp + side) {
+                    seen[u] = stamp + side;
+                    sides[side].push_back(u);
+                }
+            }
+        }
+    }
+
+    // Lightest edge leaving the smaller half. Every edge of the graph joins two vertices of one
+    // tree, so whatever leaves the smaller half ends in the other one.
+    const std::vector<int> &half = sides[small];
+    int bestWeight = 0;
+    long long best = -1;
+    for (int v : half) {
+        for (const auto &[k, w] : incident[v]) {
+            int s = static_cast<int>(k >> 32), t = static_cast<int>(k & 0xffffffff);
+            int u = s == v ? t : s;
+            if (seen[u] == stamp + small) continue;
+            if (best < 0 || w < bestWeight || (w == bestWeight && k < best)) {
+                best = k;
+                bestWeight = w;
+            }
+        }
+    }
+    if (best >= 0) {
+        link(static_cast<int>(best >> 32), static_cast<int>(best & 0xffffffff), bestWeight);
+    }
+}
+
+void DynamicMST::cut(int node) {
+    const TreeEdge edge = edgeAt[node];
+    for (int v : {edge.s, edge.t}) {
+        std::vector<int> &at = treeAt[v];
+        for (size_t i = 0; i < at.size(); i++) {
+            if (at[i] == node) {
+                at[i] = at.back();
+                at.pop_back();
+                break;
+            }
+        }
+    }
+    tree.cut(edge.s, node);
+    tree.cut(node, edge.t);
+    tree.removeNode(node);
+    treeEdges.erase(key(edge.s, edge.t));
+    totalWeight -= edge.w;
+}
@@ -0,0 +1,142 @@
+#include "../../include/dsa/EdgeSort.hpp"
+#include <algorithm>
+
+std::vector<int> sortEdgesByWeight(const CSRGraph &csr) {
+    if (csr.m == 0) return {};
+    auto [lo, hi] = std::minmax_element(csr.weights.begin(), csr.weights.end());
+    uint32_t range = static_cast<uint32_t>(static_cast<int64_t>(*hi) - *lo);
+
+    if (range < COUNTING_SORT_MAX_RANGE || range < static_cast<uint32_t>(csr.m)) {
+        return countingSortByWeight(csr, *lo, range);
+    }
+    return radixSortByWeight(csr, *lo, range);
+}
+
+std::vector<int> countingSortByWeight(const CSRGraph &csr, int minWeight, uint32_t range) {
+    // One bucket per weight value
+    std::vector<int> start(static_cast<size_t>(range) + 2, 0);
+    for (int k = 0; k < csr.m; k++) {
+        start[static_cast<uint32_t>(csr.weights[k] - minWeight) + 1]++;
+    }
+    for (size_t b = 1; b < start.size(); b++) {
+        start[b] += start[b - 1];
+    }
+
+    std::vector<int> order(csr.m);
+    for (int k = 0; k < csr.m; k++) {
+        order[start[static_cast<uint32_t>(csr.weights[k] - minWeight)]++] = k;
+    }
+    return order;
+}
+
+std::vector<int> radixSortByWeight(const CSRGraph &csr, int minWeight, uint32_t range) {
+    // Key in the high half, CSR position in the low half
+    std::vector<uint64_t> items(csr.m), buffer(csr.m);
+    for (int k = 0; k < csr.m; k++) {
+        uint32_t key = static_cast<uint32_t>(static_cast<int64_t>(csr.weights[k]) - minWeight);
+        items[k] = (static_cast<uint64_t>(key) << 32) | static_cast<uint32_t>(k);
+    }
+
+    const uint32_t buckets = 1u << RADIX_BITS;
+    std::vector<int> count(buckets);
+    // Only as many digits as the range needs
+    for (int shift = 32; shift < 64 && (range >> (shift - 32)) != 0; shift += RADIX_BITS) {
+        std::fill(count.begin(), count.end(), 0);
+        for (uint64_t item : items) {
+            count[(item >> shift) & (buckets - 1)]++;
+        }
+        int sum = 0;
+        for (uint32_t b = 0; b < buckets; b++) {
+            int c = count[b];
+            count[b] = sum;
+            sum += c;
+        }
+        for (uint64_t item : items) {
+            buffer[count[(item >> shift) & (buckets - 1)]++] = item;
+        }
+        items.swap(buffer);
+    }
+
+    std::vector<int> order(csr.m);
+    for (int i = 0; i < csr.m; i++) {
+        order[i] = static_cast<int>(items[i] & 0xffffffffu);
+    }
+    return order;
+}
+
+std::vector<int> parallelSortEdgesByWeight(const CSRGraph &csr, WorkerPool &pool) {
+    const unsigned workers = pool.size();
+    const size_t m = csr.m;
+    if (workers == 1 || m < static_cast<size_t>(workers) * 65536) {
+        return sortEdgesByWeight(csr);
+    }
+
+    // Per-worker extremes, combined below
+    std::vector<int> lows(workers, csr.weights[0]), highs(workers, csr.weights[0]);
+    const size_t chunk = (m + workers - 1) / workers;
+    auto bounds = [&](unsigned worker) {
+        size_t begin = std::min(m, worker * chunk);
+        return std::make_pair(begin, std::min(m, begin + chunk));
+    };
+    pool.run([&](unsigned worker) {
+        auto [begin, end] = bounds(worker);
+        for (size_t k = begin; k < end; k++) {
+            lows[worker] = std::min(lows[worker], csr.weights[k]);
+            highs[worker] = std::max(highs[worker], csr.weights[k]);
+        }
+    });
+    int minWeight = *std::min_element(lows.begin(), lows.end());
+    int maxWeight = *std::max_element(highs.begin(), highs.end());
+    uint32_t range = static_cast<uint32_t>(static_cast<int64_t>(maxWeight) - minWeight);
+
+    // Key in the high half, CSR position in the low half
+    std::vector<uint64_t> items(m), buffer(m);
+    pool.run([&](unsigned worker) {
+        auto [begin, end] = bounds(worker);
+        for (size_t k = begin; k < end; k++) {
+            uint32_t key = static_cast<uint32_t>(static_cast<int64_t>(csr.weights[k]) - minWeight);
+            items[k] = (static_cast<uint64_t>(key) << 32) | static_cast<uint32_t>(k);
+        }
+    });
+
+    const uint32_t buckets = 1u << RADIX_BITS;
+    // count[worker * buckets + b] - first the histogram, then the worker's scatter offset in bucket b
+    std::vector<size_t> count(static_cast<size_t>(workers) * buckets);
+    for (int shift = 32; shift < 64 && (range >> (shift - 32)) != 0; shift += RADIX_BITS) {
+        pool.run([&](unsigned worker) {
+            auto [begin, end] = bounds(worker);
+            size_t *local = &count[static_cast<size_t>(worker) * buckets];
+            std::fill(local, local + buckets, 0);
+            for (size_t i = begin; i < end; i++) {
+                local[(items[i] >> shift) & (buckets - 1)]++;
+            }
+        });
+
+        size_t sum = 0;
+        for (uint32_t b = 0; b < buckets; b++) {
+            for (unsigned w = 0; w < workers; w++) {
+                size_t c = count[static_cast<size_t>(w) * buckets + b];
+                count[static_cast<size_t>(w) * buckets + b] = sum;
+                sum += c;
+            }
+        }
+
+        pool.run([&](unsigned worker) {
+            auto [begin, end] = bounds(worker);
+            size_t *local = &count[static_cast<size_t>(worker) * buckets];
+            for (size_t i = begin; i < end; i++) {
+                buffer[local[(items[i] >> shift) & (buckets - 1)]++] = items[i];
+            }
+        });
+        items.swap(buffer);
+    }
+
+    std::vector<int> order(m);
+    pool.run([&](unsigned worker) {
+        auto [begin, end] = bounds(worker);
+        for (size_t i = begin; i < end; i++) {
+            order[i] = static_cast<int>(items[i] & 0xffffffffu);
+        }
+    });
+    return order;
+}
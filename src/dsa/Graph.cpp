@@ -1,17 +1,30 @@
 #include "../../include/dsa/Graph.hpp"
+#include <atomic>
+#include <iostream>
 
-Graph::Graph(int v) : vertices(v), edges(0) {
+// Epochs are drawn from a single counter so that two different graphs
+// (e.g. before and after new_graph) never share a stamp
+static std::atomic<unsigned long> epochCounter{0};
+
+static unsigned long nextEpoch() {
+    return ++epochCounter;
+}
+
+Graph::Graph() : vertices(0), edges(0), epoch(nextEpoch()) {
+}
+
+Graph::Graph(int v) : vertices(v), edges(0), epoch(nextEpoch()) {
     graph.resize(v);
 }
 
 // Constructor with vertices and edges
-Graph::Graph(int v, int e) : vertices(v), edges(e) {
+Graph::Graph(int v, int e) : vertices(v), edges(e), epoch(nextEpoch()) {
     // Initialize the adjacency list with v empty vectors
     graph.resize(v);
 }
 
 // Constructor with existing adjacency list
-Graph::Graph(adj_list &input_graph) {
+Graph::Graph(adj_list &input_graph) : epoch(nextEpoch()) {
     graph = input_graph;
     vertices = input_graph.size();
     
@@ -20,6 +33,67 @@ Graph::Graph(adj_list &input_graph) {
     for (const auto &neighbors : graph) {
         edges += neighbors.size();
     }
+
+    // Index the hub vertices
+    for (int u = 0; u < vertices; u++) {
+        if (graph[u].size() > EDGE_INDEX_THRESHOLD) {
+            buildIndex(u);
+        }
+    }
+}
+
+// Constructor from an edge batch
+Graph::Graph(int v, std::vector<std::tuple<int, int, int>> batch) : vertices(v), edges(0), epoch(nextEpoch()) {
+    // Drop edges with invalid vertices
+    size_t total = batch.size();
+    batch.erase(std::remove_if(batch.begin(), batch.end(), [v](const std::tuple<int, int, int> &e) {
+        auto [s, t, w] = e;
+        return s < 0 || s >= v || t < 0 || t >= v;
+    }), batch.end());
+    if (batch.size() < total) {
+        std::cerr << "Graph: Invalid vertices in " << total - batch.size()
+                  << " batch edge(s), dropped" << std::endl;
+    }
+
+    // Stable sort keeps the arrival order inside each (s,t) run, so the last one wins
+    std::stable_sort(batch.begin(), batch.end(),
+                     [](const std::tuple<int, int, int> &a, const std::tuple<int, int, int> &b) {
+                         return std::make_pair(std::get<0>(a), std::get<1>(a)) <
+                                std::make_pair(std::get<0>(b), std::get<1>(b));
+                     });
+
+    // Count the surviving edges per source so every row is allocated exactly once
+    std::vector<int> degree(v, 0);
+    for (size_t i = 0; i < batch.size(); i++) {
+        bool last = i + 1 == batch.size() ||
+                    std::get<0>(batch[i]) != std::get<0>(batch[i + 1]) ||
+                    std::get<1>(batch[i]) != std::get<1>(batch[i + 1]);
+        if (last) {
+            degree[std::get<0>(batch[i])]++;
+        }
+    }
+
+    graph.resize(v);
+    for (int u = 0; u < v; u++) {
+        graph[u].reserve(degree[u]);
+    }
+    for (size_t i = 0; i < batch.size(); i++) {
+        bool last = i + 1 == batch.size() ||
+                    std::get<0>(batch[i]) != std::get<0>(batch[i + 1]) ||
+                    std::get<1>(batch[i]) != std::get<1>(batch[i + 1]);
+        if (last) {
+            auto [s, t, w] = batch[i];
+            graph[s].emplace_back(t, w);
+            edges++;
+        }
+    }
+
+    // Index the hub vertices
+    for (int u = 0; u < v; u++) {
+        if (graph[u].size() > EDGE_INDEX_THRESHOLD) {
+            buildIndex(u);
+        }
+    }
 }
 
 // Add a directed edge from s to t with weight w
@@ -28,21 +102,28 @@ void Graph::addEdge(int s, int t, int w) {
     if (s >= vertices || t >= vertices || s < 0 || t < 0) {
         return; // Invalid vertices
     }
-    
-    // Check if edge already exists
-    if (edgeExists(s, t)) {
-        // Update the weight if the edge already exists
-        for (auto &edge : graph[s]) {
-            if (edge.first == t) {
-                edge.second = w;
-                return;
-            }
+
+    int pos = findEdge(s, t);
+    if (pos != -1) {
+        // Same edge again: nothing changes, so everything cached for this epoch stays valid
+        if (graph[s][pos].second == w) {
+            return;
         }
+        // Update the weight if the edge already exists
+        graph[s][pos].second = w;
     } else {
         // Add new edge
         graph[s].emplace_back(t, w);
         edges++;
+
+        int degree = static_cast<int>(graph[s].size());
+        if (degree == EDGE_INDEX_THRESHOLD + 1) {
+            buildIndex(s);
+        } else if (degree > EDGE_INDEX_THRESHOLD) {
+            hubIndex[s][t] = degree - 1;
+        }
     }
+    touch();
 }
 
 // Remove an edge from s to t
@@ -51,14 +132,31 @@ void Graph::removeEdge(int s, int t) {
         return;
     }
 
-    auto& vertex_edges = graph[s];
-    for (auto it = vertex_edges.begin(); it != vertex_edges.end(); ++it) {
-        if (it->first == t) {
-            vertex_edges.erase(it);
-            edges--;
-            return;
+    int pos = findEdge(s, t);
+    if (pos == -1) {
+        return;
+    }
+
+    // Move the last edge into the freed slot so removal is O(1)
+    auto &vertex_edges = graph[s];
+    int last = static_cast<int>(vertex_edges.size()) - 1;
+    vertex_edges[pos] = vertex_edges[last];
+    vertex_edges.pop_back();
+    edges--;
+
+    auto it = hubIndex.find(s);
+    if (it != hubIndex.end()) {
+        if (vertex_edges.size() > EDGE_INDEX_THRESHOLD) {
+            it->second.erase(t);
+            if (pos != last) {
+                it->second[vertex_edges[pos].first] = pos;
+            }
+        } else {
+            // Back to a low-degree vertex, linear scans are cheaper again
+            hubIndex.erase(it);
         }
     }
+    touch();
 }
 
 // Check if an edge exists from u to v
@@ -67,14 +165,63 @@ bool Graph::edgeExists(int u, int v) const {
     if (u >= vertices || v >= vertices || u < 0 || v < 0) {
         return false; // Invalid vertices
     }
-    
+    return findEdge(u, v) != -1;
+}
+
+int Graph::findEdge(int u, int v) const {
+    // Hub vertices always have an index entry
+    if (graph[u].size() > EDGE_INDEX_THRESHOLD) {
+        const auto &index = hubIndex.at(u);
+        auto pos = index.find(v);
+        return pos == index.end() ? -1 : pos->second;
+    }
+
     // Search for the edge in the adjacency list
-    for (const auto &edge : graph[u]) {
-        if (edge.first == v) {
-            return true;
+    const auto &vertex_edges = graph[u];
+    for (int i = 0; i < static_cast<int>(vertex_edges.size()); i++) {
+        if (vertex_edges[i].first == v) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+void Graph::buildIndex(int u) {
+    auto &index = hubIndex[u];
+    index.clear();
+    index.reserve(graph[u].size() * 2);
+    for (int i = 0; i < static_cast<int>(graph[u].size()); i++) {
+        index[graph[u][i].first] = i;
+    }
+}
+
+void Graph::touch() {
+    epoch = nextEpoch();
+}
+
+const CSRGraph& Graph::getCSR() {
+    if (csrEpoch != epoch) {
+        csr = CSRGraph(graph);
+        csrEpoch = epoch;
+    }
+    return csr;
+}
+
+bool Graph::isUndirected() {
+    if (undirectedEpoch != epoch) {
+        undirected = true;
+        for (int u = 0; u < vertices && undirected; u++) {
+            for (const auto &edge : graph[u]) {
+                int pos = findEdge(edge.first, u);
+                if (pos == -1 || graph[edge.first][pos].second != edge.second) {
+                    undirected = false;
+                    break;
+                }
+            }
         }
+        undirectedEpoch = epoch;
     }
-    return false;
+    return undirected;
 }
 
 std::pair<std::vector<std::tuple<int, int, int, int>>, int> Graph::getAsPair() {
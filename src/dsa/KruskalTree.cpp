@@ -0,0 +1,110 @@
+#include "../../include/dsa/KruskalTree.hpp"
+#include "../../include/dsa/UnionFind.hpp"
+#include <algorithm>
+#include <bit>
+#include <climits>
+
+KruskalTree::KruskalTree(int n, const std::vector<std::tuple<int, int, int, int>> &edges) {
+    // Leaf order of every component as a linked list, a union appends one list to the other
+    // and the gap at the junction is the weight of the union
+    UnionFind uf(n);
+    std::vector<int> head(n), tail(n), next(n, -1), gapAfter(n, INT_MIN);
+    for (int v = 0; v < n; v++) {
+        head[v] = tail[v] = v;
+    }
+    for (const auto &[s, t, w, id] : edges) {
+        int a = uf.find_parent(s);
+        int b = uf.find_parent(t);
+        if (a == b || !uf.unite(a, b)) continue;
+
+        int joined = uf.find_parent(a);
+        next[tail[a]] = head[b];
+        gapAfter[tail[a]] = w;
+        head[joined] = head[a];
+        tail[joined] = tail[b];
+    }
+
+    // Lay the trees out one after the other
+    pos.assign(n, 0);
+    treeBegin.assign(n, 0);
+    treeEnd.assign(n, 0);
+    std::vector<int> gaps(std::max(n - 1, 0), INT_MIN);
+    int at = 0;
+    for (int r = 0; r < n; r++) {
+        if (uf.find_parent(r) != r) continue;
+
+        int begin = at;
+        for (int v = head[r]; v >= 0; v = next[v]) {
+            pos[v] = at;
+            if (next[v] >= 0) {
+                gaps[at] = gapAfter[v];
+            }
+            at++;
+        }
+        std::fill(treeBegin.begin() + begin, treeBegin.begin() + at, begin);
+        std::fill(treeEnd.begin() + begin, treeEnd.begin() + at, at);
+    }
+
+    table.push_back(std::move(gaps));
+    int m = static_cast<int>(table[0].size());
+    for (int half = 1; 2 * half <= m; half *= 2) {
+        const std::vector<int> &prev = table.back();
+        std::vector<int> wider(m - 2 * half + 1);
+        for (int i = 0; i < static_cast<int>(wider.size()); i++) {
+            wider[i] = std::max(prev[i], prev[i + half]);
+        }
+        table.push_back(std::move(wider));
+    }
+}
+
+KruskalTree::KruskalTree(const MST &forest) {
+    std::vector<std::tuple<int, int, int, int>> edges;
+    edges.reserve(forest.getNumEdges());
+    for (const auto &[s, t, w] : forest.getEdgeList()) {
+        edges.emplace_back(s, t, w, 0);
+    }
+    std::sort(edges.begin(), edges.end(),
+              [](const auto &a, const auto &b) { return std::get<2>(a) < std::get<2>(b); });
+    *this = KruskalTree(forest.getNumVertices(), edges);
+}
+
+int KruskalTree::maxGap(int from, int to) const {
+    int k = std::bit_width(static_cast<unsigned>(to - from)) - 1;
+    return std::max(table[k][from], table[k][to - (1 << k)]);
+}
+
+bool KruskalTree::connected(int u, int v, int threshold) const {
+    int n = getNumVertices();
+    if (u < 0 || u >= n || v < 0 || v >= n) {
+        return false;
+    }
+    if (u == v) {
+        return true;
+    }
+
+    int a = std::min(pos[u], pos[v]);
+    int b = std::max(pos[u], pos[v]);
+    if (treeEnd[a] <= b) {
+        return false;
+    }
+    return maxGap(a, b) <= threshold;
+}
+
+int KruskalTree::componentSize(int u, int threshold) const {
+    if (u < 0 || u >= getNumVertices()) {
+        return 0;
+    }
+
+    // Widen the range one power of two at a time, largest first, without leaving the tree
+    int left = pos[u], right = pos[u];
+    for (int k = static_cast<int>(table.size()) - 1; k >= 0; k--) {
+        int step = 1 << k;
+        if (right + step < treeEnd[pos[u]] && table[k][right] <= threshold) {
+            right += step;
+        }
+        if (left - step >= treeBegin[pos[u]] && table[k][left - step] <= threshold) {
+            left -= step;
+        }
+    }
+    return right - left + 1;
+}
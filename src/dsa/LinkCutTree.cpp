@@ -0,0 +1,156 @@
+#include "../../include/dsa/LinkCutTree.hpp"
+#include <utility>
+
+LinkCutTree::LinkCutTree(int n, int value) : nodes(n + 1) {
+    for (int x = 1; x <= n; x++) {
+        nodes[x].value = value;
+        nodes[x].best = x;
+    }
+}
+
+int LinkCutTree::addNode(int value) {
+    int x;
+    if (!freeNodes.empty()) {
+        x = freeNodes.back();
+        freeNodes.pop_back();
+        nodes[x] = Node();
+    } else {
+        x = static_cast<int>(nodes.size());
+        nodes.emplace_back();
+    }
+    nodes[x].value = value;
+    nodes[x].best = x;
+    return x - 1;
+}
+
+void LinkCutTree::removeNode(int x) {
+    freeNodes.push_back(x + 1);
+}
+
+bool LinkCutTree::isSplayRoot(int x) const {
+    int p = nodes[x].parent;
+    return p == 0 || (nodes[p].child[0] != x && nodes[p].child[1] != x);
+}
+
+void LinkCutTree::pull(int x) {
+    Node &node = nodes[x];
+    node.best = x;
+    for (int c : node.child) {
+        if (c != 0 && nodes[nodes[c].best].value > nodes[node.best].value) {
+            node.best = nodes[c].best;
+        }
+    }
+}
+
+void LinkCutTree::push(int x) {
+    Node &node = nodes[x];
+    if (!node.flip) return;
+    std::swap(node.child[0], node.child[1]);
+    for (int c : node.child) {
+        if (c != 0) nodes[c].flip = !nodes[c].flip;
+    }
+    node.flip = false;
+}
+
+void LinkCutTree::rotate(int x) {
+    int p = nodes[x].parent;
+    int g = nodes[p].parent;
+    int side = nodes[p].child[1] == x;
+
+    // x takes p's place under g (a path-parent pointer if p was a splay root)
+    if (!isSplayRoot(p)) {
+        nodes[g].child[nodes[g].child[1] == p] = x;
+    }
+    nodes[x].parent = g;
+
+    int moved = nodes[x].child[!side];
+    nodes[p].child[side] = moved;
+    if (moved != 0) nodes[moved].parent = p;
+
+    nodes[x].child[!side] = p;
+    nodes[p].parent = x;
+    pull(p);
+    pull(x);
+}
+
+void LinkCutTree::splay(int x) {
+    // Push pending flips from the splay root down to x first
+    pending.clear();
+    pending.push_back(x);
+    for (int y = x; !isSplayRoot(y); y = nodes[y].parent) {
+        pending.push_back(nodes[y].parent);
+    }
+    for (auto it = pending.rbegin(); it != pending.rend(); ++it) {
+        push(*it);
+    }
+
+    while (!isSplayRoot(x)) {
+        int p = nodes[x].parent;
+        if (!isSplayRoot(p)) {
+            int g = nodes[p].parent;
+            bool zigzig = (nodes[g].child[1] == p) == (nodes[p].child[1] == x);
+            rotate(zigzig ? p : x);
+        }
+        rotate(x);
+    }
+}
+
+void LinkCutTree::access(int x) {
+    // Make the root .. x path preferred, x ends up at the root of its splay tree
+    int last = 0;
+    for (int y = x; y != 0; y = nodes[y].parent) {
+        splay(y);
+        nodes[y].child[1] = last;
+        pull(y);
+        last = y;
+    }
+    splay(x);
+}
+
+void LinkCutTree::makeRoot(int x) {
+    access(x);
+    nodes[x].flip = !nodes[x].flip;
+}
+
+int LinkCutTree::findRoot(int x) {
+    access(x);
+    while (true) {
+        push(x);
+        if (nodes[x].child[0] == 0) break;
+        x = nodes[x].child[0];
+    }
+    splay(x);
+    return x;
+}
+
+void LinkCutTree::link(int x, int y) {
+    makeRoot(x + 1);
+    nodes[x + 1].parent = y + 1;
+}
+
+void LinkCutTree::cut(int x, int y) {
+    makeRoot(x + 1);
+    access(y + 1);
+    // x is now the only node left of y on the path
+    nodes[y + 1].child[0] = 0;
+    nodes[x + 1].parent = 0;
+    pull(y + 1);
+}
+
+bool LinkCutTree::connected(int x, int y) {
+    if (x == y) return true;
+    return findRoot(x + 1) == findRoot(y + 1);
+}
+
+int LinkCutTree::pathMax(int x, int y) {
+    makeRoot(x + 1);
+    access(y + 1);
+    return nodes[y + 1].best - 1;
+}
+
+void LinkCutTree::setValue(int x, int value) {
+    // x becomes a splay root first, so no ancestor caches its old value
+    access(x + 1);
+    nodes[x + 1].value = value;
+    pull(x + 1);
+}
@@ -1,42 +1,77 @@
 #include "../../include/dsa/MST.hpp"
 #include <iostream>
 
-MST::MST(int vertices) : totalWeight(0), numVertices(vertices) {
-    // Initialize empty MST
-    mstAdjList.resize(vertices);
+MST::MST(int vertices) : totalWeight(0), numVertices(vertices), views(std::make_shared<Views>()) {
+    if (vertices < 0) {
+        throw std::invalid_argument("MST: negative number of vertices");
+    }
 }
 
-MST::MST(const std::vector<std::tuple<int, int, int, int>>& edges, int vertices)
-    : totalWeight(0), numVertices(vertices) {
-
-    // Initialize MST adjacency list
-    mstAdjList.resize(vertices);
+MST::MST(const std::vector<std::tuple<int, int, int, int>>& edges, int vertices) : MST(vertices) {
+    edgeList.reserve(edges.size());
 
     // Add edges to MST
     for (const auto& edge : edges) {
         int u = std::get<0>(edge);
         int v = std::get<1>(edge);
         int weight = std::get<2>(edge);
-        // Add edge to MST
-        addEdge(u, v, weight);
+        appendEdge(u, v, weight);
     }
 }
 
 void MST::addEdge(int u, int v, int weight) {
+    if (appendEdge(u, v, weight)) {
+        // Views built so far (possibly shared with copies) no longer describe this MST,
+        // the next reader creates fresh ones
+        views.reset();
+    }
+}
+
+bool MST::appendEdge(int u, int v, int weight) {
     if (u < 0 || u >= numVertices || v < 0 || v >= numVertices) {
         std::cerr << "MST: Invalid vertices in addEdge: " << u << ", " << v << std::endl;
-        return;
+        return false;
     }
 
-    // Add to edge set
-    edges.insert(std::make_tuple(u, v, weight));
+    edgeList.emplace_back(u, v, weight);
 
     // Update total weight
     totalWeight += weight;
+    return true;
+}
 
-    // Add to adjacency list (bidirectional for MST)
-    mstAdjList[u].push_back(std::make_pair(v, weight));
-    mstAdjList[v].push_back(std::make_pair(u, weight));
+MST::Views& MST::derived() const {
+    // Readers of a shared const MST may get here together, only one of them installs the views
+    std::shared_ptr<Views> current = std::atomic_load(&views);
+    if (!current) {
+        std::shared_ptr<Views> fresh = std::make_shared<Views>();
+        std::atomic_compare_exchange_strong(&views, &current, fresh);
+        current = std::atomic_load(&views);
+    }
+    return *current;
+}
+
+const MST::Views& MST::treeCSR() const {
+    Views& v = derived();
+    std::call_once(v.csrOnce, [this, &v]() {
+        // Counting sort of both directions of every edge by their first endpoint. Each vertex
+        // keeps its neighbors in insertion order, as the adjacency view would.
+        v.offsets.assign(numVertices + 1, 0);
+        for (const auto& [a, b, w] : edgeList) {
+            v.offsets[a + 1]++;
+            v.offsets[b + 1]++;
+        }
+        for (int i = 0; i < numVertices; i++) {
+            v.offsets[i + 1] += v.offsets[i];
+        }
+        v.neighbors.resize(2 * edgeList.size());
+        std::vector<int> next(v.offsets.begin(), v.offsets.end() - 1);
+        for (const auto& [a, b, w] : edgeList) {
+            v.neighbors[next[a]++] = {b, w};
+            v.neighbors[next[b]++] = {a, w};
+        }
+    });
+    return v;
 }
 
 int MST::getTotalWeight() const {
@@ -44,7 +79,11 @@ int MST::getTotalWeight() const {
 }
 
 const std::set<edge>& MST::getEdges() const {
-    return edges;
+    Views& v = derived();
+    std::call_once(v.setOnce, [this, &v]() {
+        v.edges.insert(edgeList.begin(), edgeList.end());
+    });
+    return v.edges;
 }
 
 int MST::getNumVertices() const {
@@ -52,101 +91,137 @@ int MST::getNumVertices() const {
 }
 
 const adj_list& MST::getMstAdjList() const {
-    return mstAdjList;
+    const Views& tree = treeCSR();
+    Views& v = derived();
+    std::call_once(v.adjOnce, [this, &tree, &v]() {
+        v.adj.resize(numVertices);
+        for (int u = 0; u < numVertices; u++) {
+            v.adj[u].assign(tree.neighbors.begin() + tree.offsets[u], tree.neighbors.begin() + tree.offsets[u + 1]);
+        }
+    });
+    return v.adj;
 }
 
 int MST::findLongestDistance() const {
-    if (numVertices == 0) return 0;
-
-    int maxDistance = 0;
-
-    for (int i = 0; i < numVertices; i++) {
-        std::vector<bool> visited(numVertices, false);
-        int farthestNode = -1;
-        int distance = 0;
-
-        // DFS from each node to find longest path
-        dfs(i, 0, visited, distance, farthestNode);
-
-        if (distance > maxDistance) {
-            maxDistance = distance;
-        }
-    }
-
-    return maxDistance;
+    return static_cast<int>(findDiameter().length);
 }
 
-void MST::dfs(int node, int distance, std::vector<bool>& visited, int& maxDist, int& farthestNode) const {
-    visited[node] = true;
+TreePath MST::findDiameter() const {
+    Views& v = derived();
+    std::call_once(v.diameterOnce, [this, &v]() { v.diameter = computeDiameter(); });
+    return v.diameter;
+}
 
-    if (distance > maxDist) {
-        maxDist = distance;
-        farthestNode = node;
+TreePath MST::computeDiameter() const {
+    TreePath best;
+    if (numVertices == 0) return best;
+
+    std::vector<int> order, parent, parentWeight;
+    flatten(order, parent, parentWeight);
+
+    // down[v] - heaviest path from v down into its subtree (0 for v alone), ending at downEnd[v].
+    // Children come after their parent in the preorder, so a reverse sweep finishes them first.
+    std::vector<long long> down(numVertices, 0);
+    std::vector<int> downEnd(numVertices);
+    // The two heaviest downward paths met so far at every vertex
+    std::vector<long long> second(numVertices, 0);
+    std::vector<int> secondEnd(numVertices);
+    for (int v = 0; v < numVertices; v++) {
+        downEnd[v] = secondEnd[v] = v;
     }
 
-    for (const auto& neighbor : mstAdjList[node]) {
-        int nextNode = neighbor.first;
-        int edgeWeight = neighbor.second;
+    best = {0, order.front(), order.front()};
+    for (auto it = order.rbegin(); it != order.rend(); ++it) {
+        int v = *it;
+        // The heaviest path bending at v joins its two heaviest downward paths
+        if (down[v] + second[v] > best.length) {
+            best = {down[v] + second[v], downEnd[v], secondEnd[v]};
+        }
 
-        if (!visited[nextNode]) {
-            dfs(nextNode, distance + edgeWeight, visited, maxDist, farthestNode);
+        int p = parent[v];
+        if (p < 0) continue;
+        long long up = down[v] + parentWeight[v];
+        if (up > down[p]) {
+            second[p] = down[p];
+            secondEnd[p] = downEnd[p];
+            down[p] = up;
+            downEnd[p] = downEnd[v];
+        } else if (up > second[p]) {
+            second[p] = up;
+            secondEnd[p] = downEnd[v];
         }
     }
+    return best;
 }
 
-double MST::findAverageDistance() const {
-    if (numVertices <= 1) return 0.0;
-
-    // Use Floyd-Warshall to compute all pairs shortest paths
-    std::vector<std::vector<int>> dist = floydWarshall();
+void MST::flatten(std::vector<int>& order, std::vector<int>& parent, std::vector<int>& parentWeight) const {
+    order.clear();
+    order.reserve(numVertices);
+    parent.assign(numVertices, -1);
+    parentWeight.assign(numVertices, 0);
 
-    // Calculate sum of all distances
-    long long sum = 0;
-    int count = 0;
-
-    for (int i = 0; i < numVertices; i++) {
-        for (int j = i + 1; j < numVertices; j++) {
-            if (dist[i][j] < std::numeric_limits<int>::max()) {
-                sum += dist[i][j];
-                count++;
+    // Iterative DFS from every vertex not reached yet, so paths of any length are fine
+    const Views& tree = treeCSR();
+    std::vector<bool> visited(numVertices, false);
+    std::vector<int> stack;
+    for (int root = 0; root < numVertices; root++) {
+        if (visited[root]) continue;
+        visited[root] = true;
+        stack.push_back(root);
+        while (!stack.empty()) {
+            int u = stack.back();
+            stack.pop_back();
+            order.push_back(u);
+            for (int i = tree.offsets[u]; i < tree.offsets[u + 1]; i++) {
+                auto [v, w] = tree.neighbors[i];
+                if (!visited[v]) {
+                    visited[v] = true;
+                    parent[v] = u;
+                    parentWeight[v] = w;
+                    stack.push_back(v);
+                }
             }
         }
     }
-
-    // Return average
-    return (count > 0) ? static_cast<double>(sum) / count : 0.0;
 }
 
-std::vector<std::vector<int>> MST::floydWarshall() const {
-    const int INF = std::numeric_limits<int>::max();
+double MST::findAverageDistance() const {
+    Views& v = derived();
+    std::call_once(v.averageOnce, [this, &v]() { v.average = computeAverageDistance(); });
+    return v.average;
+}
 
-    // Initialize distance matrix
-    std::vector<std::vector<int>> dist(numVertices, std::vector<int>(numVertices, INF));
+double MST::computeAverageDistance() const {
+    if (numVertices <= 1) return 0.0;
 
-    // Set distances for direct edges
-    for (int i = 0; i < numVertices; i++) {
-        dist[i][i] = 0;  // Distance to self is 0
+    std::vector<int> order, parent, parentWeight;
+    flatten(order, parent, parentWeight);
 
-        for (const auto& edge : mstAdjList[i]) {
-            int j = edge.first;
-            int weight = edge.second;
-            dist[i][j] = weight;
+    // Subtree sizes, children before parents
+    std::vector<int> size(numVertices, 1);
+    for (auto it = order.rbegin(); it != order.rend(); ++it) {
+        if (parent[*it] >= 0) {
+            size[parent[*it]] += size[*it];
         }
     }
 
-    // Floyd-Warshall algorithm
-    for (int k = 0; k < numVertices; k++) {
-        for (int i = 0; i < numVertices; i++) {
-            for (int j = 0; j < numVertices; j++) {
-                if (dist[i][k] != INF && dist[k][j] != INF &&
-                    dist[i][k] + dist[k][j] < dist[i][j]) {
-                    dist[i][j] = dist[i][k] + dist[k][j];
-                }
-            }
+    // Every edge lies on the path of each pair it separates: size * (component size - size) pairs.
+    // Only pairs inside one tree have a distance.
+    __int128 sum = 0;
+    long long pairs = 0;
+    int root = -1;
+    for (int v : order) {
+        if (parent[v] < 0) {
+            root = v;
+            pairs += static_cast<long long>(size[v]) * (size[v] - 1) / 2;
+            continue;
         }
+        long long separated = static_cast<long long>(size[v]) * (size[root] - size[v]);
+        sum += static_cast<__int128>(parentWeight[v]) * separated;
     }
 
-    return dist;
+    // Return average
+    return pairs > 0 ? static_cast<double>(sum) / static_cast<double>(pairs) : 0.0;
 }
 
 int MST::findShortestPathWithMstEdge(const adj_list& originalGraph, int src, int dest) const {
@@ -156,40 +231,28 @@ int MST::findShortestPathWithMstEdge(const adj_list& originalGraph, int src, int
         return -1;
     }
 
-    // Use Dijkstra's algorithm for shortest path
-    std::vector<int> dist(numVertices, std::numeric_limits<int>::max());
+    // The path between two tree vertices is unique: walk the tree from src until dest
+    const Views& tree = treeCSR();
+    std::vector<int> dist(numVertices, 0);
     std::vector<bool> visited(numVertices, false);
+    std::vector<int> stack{src};
+    visited[src] = true;
 
-    // Priority queue for Dijkstra
-    std::priority_queue<std::pair<int, int>,
-                       std::vector<std::pair<int, int>>,
-                       std::greater<std::pair<int, int>>> pq;
-
-    // Initialize source
-    dist[src] = 0;
-    pq.push(std::make_pair(0, src));
-
-
-    while (!pq.empty()) {
-        int u = pq.top().second;
-        pq.pop();
-
-        if (visited[u]) continue;
-        visited[u] = true;
+    while (!stack.empty()) {
+        int u = stack.back();
+        stack.pop_back();
 
         // If destination reached
         if (u == dest) {
             return dist[dest];
         }
 
-        // Check all neighbors in MST
-        for (const auto& edge : mstAdjList[u]) {
-            int v = edge.first;
-            int weight = edge.second;
-
-            if (!visited[v] && dist[u] + weight < dist[v]) {
+        for (int i = tree.offsets[u]; i < tree.offsets[u + 1]; i++) {
+            auto [v, weight] = tree.neighbors[i];
+            if (!visited[v]) {
+                visited[v] = true;
                 dist[v] = dist[u] + weight;
-                pq.push(std::make_pair(dist[v], v));
+                stack.push_back(v);
             }
         }
     }
@@ -199,6 +262,12 @@ int MST::findShortestPathWithMstEdge(const adj_list& originalGraph, int src, int
 }
 
 std::string MST::toString() const {
+    Views& v = derived();
+    std::call_once(v.textOnce, [this, &v]() { v.text = computeString(); });
+    return v.text;
+}
+
+std::string MST::computeString() const {
     std::stringstream ss;
 
     ss << "Vertices: " << numVertices << std::endl;
@@ -207,10 +276,11 @@ std::string MST::toString() const {
     // Print MST edges (using a set to avoid duplicates in undirected representation)
     std::set<std::pair<int, int>> printed;
 
+    const Views& tree = treeCSR();
     for (int i = 0; i < numVertices; i++) {
-        for (const auto& edge : mstAdjList[i]) {
-            int neighbor = edge.first;
-            int weight = edge.second;
+        for (int k = tree.offsets[i]; k < tree.offsets[i + 1]; k++) {
+            int neighbor = tree.neighbors[k].first;
+            int weight = tree.neighbors[k].second;
 
             // For undirected MST, only print each edge once
             if (printed.find(std::make_pair(std::min(i, neighbor), std::max(i, neighbor))) == printed.end()) {
@@ -0,0 +1,180 @@
+#include "../../include/dsa/OfflineDynamicMST.hpp"
+#include <algorithm>
+#include <climits>
+#include <numeric>
+
+// Weight of a slot whose edge is not in the graph
+#define ABSENT_WEIGHT (LLONG_MAX / 4)
+
+std::vector<long long> OfflineDynamicMST::run(const CSRGraph &csr, const std::vector<ScriptOp> &ops) {
+    OfflineDynamicMST offline(csr.n);
+    const int n = csr.n;
+
+    // One slot per (s, t) pair that ever exists, self loops never matter
+    std::unordered_map<long long, int> slotOf;
+    std::vector<Edge> edges;
+    auto slot = [&](int s, int t) {
+        long long key = (static_cast<long long>(s) << 32) | static_cast<unsigned>(t);
+        auto [it, added] = slotOf.try_emplace(key, static_cast<int>(edges.size()));
+        if (added) {
+            edges.push_back({s, t, it->second});
+            offline.weights.push_back(ABSENT_WEIGHT);
+        }
+        return it->second;
+    };
+    for (int k = 0; k < csr.m; k++) {
+        if (csr.sources[k] != csr.targets[k]) {
+            offline.weights[slot(csr.sources[k], csr.targets[k])] = csr.weights[k];
+        }
+    }
+
+    // Every query is answered after the modifications that precede it
+    std::vector<int> queryAfter;
+    for (const ScriptOp &op : ops) {
+        if (op.kind == ScriptOp::Query) {
+            queryAfter.push_back(static_cast<int>(offline.mods.size()));
+            continue;
+        }
+        // Invalid edges never reach the graph
+        if (op.s < 0 || op.s >= n || op.t < 0 || op.t >= n || op.s == op.t) continue;
+        long long w = op.kind == ScriptOp::Add ? op.w : ABSENT_WEIGHT;
+        offline.mods.emplace_back(slot(op.s, op.t), w);
+    }
+
+    // Queries before the first modification see the initial graph
+    long long before = 0;
+    if (!queryAfter.empty() && queryAfter.front() == 0) {
+        before = offline.kruskal(edges, offline.currentWeights(edges), nullptr);
+        offline.uf.rollback(0);
+    }
+
+    int q = static_cast<int>(offline.mods.size());
+    if (q > 0) {
+        offline.answers.resize(q);
+        offline.modifiedIn.assign(edges.size(), 0);
+        offline.solve(0, q - 1, edges, 0);
+    }
+
+    std::vector<long long> result;
+    result.reserve(queryAfter.size());
+    for (int after : queryAfter) {
+        result.push_back(after == 0 ? before : offline.answers[after - 1]);
+    }
+    return result;
+}
+
+std::vector<ScriptOp> OfflineDynamicMST::parse(std::istream &in) {
+    std::vector<ScriptOp> ops;
+    std::string kind;
+    while (in >> kind) {
+        ScriptOp op{ScriptOp::Query};
+        if (kind == "a") {
+            op.kind = ScriptOp::Add;
+            in >> op.s >> op.t >> op.w;
+        } else if (kind == "r") {
+            op.kind = ScriptOp::Remove;
+            in >> op.s >> op.t;
+        } else if (kind != "q") {
+            break;
+        }
+        if (!in) break;
+        ops.push_back(op);
+    }
+    return ops;
+}
+
+void OfflineDynamicMST::solve(int l, int r, std::vector<Edge> &edges, long long base) {
+    if (l == r) {
+        weights[mods[l].first] = mods[l].second;
+        int mark = uf.snapshot();
+        answers[l] = base + kruskal(edges, currentWeights(edges), nullptr);
+        uf.rollback(mark);
+        return;
+    }
+
+    // Slots modified somewhere in [l, r]
+    unsigned range = ++stamp;
+    for (int i = l; i <= r; i++) {
+        modifiedIn[mods[i].first] = range;
+    }
+    auto modified = [&](const Edge &e) { return modifiedIn[e.slot] == range; };
+
+    // Contraction: unmodified edges in the forest even with every modified edge at -infinity
+    // are in the forest at every time of the range
+    std::vector<long long> key(edges.size());
+    for (size_t i = 0; i < edges.size(); i++) {
+        key[i] = modified(edges[i]) ? LLONG_MIN : weights[edges[i].slot];
+    }
+    std::vector<char> taken;
+    int mark = uf.snapshot();
+    kruskal(edges, key, &taken);
+    uf.rollback(mark);
+    for (size_t i = 0; i < edges.size(); i++) {
+        if (taken[i] && !modified(edges[i])) {
+            uf.unite(edges[i].u, edges[i].v);
+            if (weights[edges[i].slot] != ABSENT_WEIGHT) {
+                base += weights[edges[i].slot];
+            }
+        }
+    }
+
+    // Contracted endpoints, edges inside a component can never be in the forest again
+    std::vector<Edge> rest;
+    rest.reserve(edges.size());
+    for (const Edge &e : edges) {
+        int u = uf.find_parent(e.u), v = uf.find_parent(e.v);
+        if (u != v) {
+            rest.push_back({u, v, e.slot});
+        }
+    }
+
+    // Reduction: unmodified edges out of the forest even with every modified edge at +infinity
+    // are out of it at every time of the range
+    key.assign(rest.size(), 0);
+    for (size_t i = 0; i < rest.size(); i++) {
+        key[i] = modified(rest[i]) ? LLONG_MAX : weights[rest[i].slot];
+    }
+    int contracted = uf.snapshot();
+    kruskal(rest, key, &taken);
+    uf.rollback(contracted);
+    std::vector<Edge> kept;
+    kept.reserve(rest.size());
+    for (size_t i = 0; i < rest.size(); i++) {
+        if (taken[i] || modified(rest[i])) {
+            kept.push_back(rest[i]);
+        }
+    }
+    rest.clear();
+    rest.shrink_to_fit();
+
+    int mid = l + (r - l) / 2;
+    solve(l, mid, kept, base);
+    solve(mid + 1, r, kept, base);
+    uf.rollback(mark);
+}
+
+std::vector<long long> OfflineDynamicMST::currentWeights(const std::vector<Edge> &edges) const {
+    std::vector<long long> key(edges.size());
+    for (size_t i = 0; i < edges.size(); i++) {
+        key[i] = weights[edges[i].slot];
+    }
+    return key;
+}
+
+long long OfflineDynamicMST::kruskal(const std::vector<Edge> &edges, const std::vector<long long> &key,
+                                     std::vector<char> *taken) {
+    std::vector<int> order(edges.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&key](int a, int b) { return key[a] < key[b]; });
+
+    if (taken) taken->assign(edges.size(), 0);
+    long long total = 0;
+    for (int i : order) {
+        if (uf.unite(edges[i].u, edges[i].v)) {
+            if (taken) (*taken)[i] = 1;
+            long long w = weights[edges[i].slot];
+            if (w != ABSENT_WEIGHT) total += w;
+        }
+    }
+    return total;
+}
@@ -0,0 +1,58 @@
+#include "../../include/dsa/RollbackUnionFind.hpp"
+#include <utility>
+
+RollbackUnionFind::RollbackUnionFind(int _n) : n(_n), cc(_n) {
+    parent.resize(n);
+    rank.resize(n, 0);
+
+    // Initialize each element as its own parent
+    for (int i = 0; i < n; i++) {
+        parent[i] = i;
+    }
+}
+
+int RollbackUnionFind::find_parent(int node) const {
+    while (parent[node] != node) {
+        node = parent[node];
+    }
+    return node;
+}
+
+bool RollbackUnionFind::unite(int x, int y) {
+    int root_x = find_parent(x);
+    int root_y = find_parent(y);
+
+    // Already in the same set
+    if (root_x == root_y) {
+        return false;
+    }
+
+    // Union by rank: attach smaller rank tree under root of higher rank tree
+    if (rank[root_x] < rank[root_y]) {
+        std::swap(root_x, root_y);
+    }
+    bool grew = rank[root_x] == rank[root_y];
+    parent[root_y] = root_x;
+    if (grew) {
+        rank[root_x]++;
+    }
+    history.emplace_back(root_y, grew);
+
+    // Decrease the count of connected components
+    cc--;
+
+    return true;
+}
+
+void RollbackUnionFind::rollback(int snapshot) {
+    while (static_cast<int>(history.size()) > snapshot) {
+        auto [child, grew] = history.back();
+        history.pop_back();
+        int root = parent[child];
+        if (grew) {
+            rank[root]--;
+        }
+        parent[child] = child;
+        cc++;
+    }
+}
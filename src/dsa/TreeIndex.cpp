@@ -0,0 +1,163 @@
+#include "../../include/dsa/TreeIndex.hpp"
+#include <algorithm>
+#include <bit>
+
+TreeIndex::TreeIndex(const MST &forest) {
+    int n = forest.getNumVertices();
+    std::vector<int> parent, parentWeight;
+    forest.flatten(order, parent, parentWeight);
+
+    pos.assign(n, 0);
+    root.assign(n, 0);
+    rootDist.assign(n, 0);
+    depth.assign(n, 0);
+    for (int i = 0; i < n; i++) {
+        pos[order[i]] = i;
+    }
+
+    // Parents come first in preorder, so their root and distance are already known
+    std::vector<int> level(n);
+    std::vector<int> up(n), upMax(n, INT_MIN);
+    int maxDepth = 0;
+    for (int i = 0; i < n; i++) {
+        int v = order[i];
+        int p = parent[v];
+        if (p < 0) {
+            root[v] = v;
+            level[i] = i;
+            up[v] = v;
+        } else {
+            root[v] = root[p];
+            rootDist[v] = rootDist[p] + parentWeight[v];
+            depth[v] = depth[p] + 1;
+            maxDepth = std::max(maxDepth, depth[v]);
+            level[i] = pos[p];
+            up[v] = p;
+            upMax[v] = parentWeight[v];
+        }
+    }
+
+    // Jumps up to the deepest vertex only, shallow trees stay small
+    jump.push_back(std::move(up));
+    jumpMax.push_back(std::move(upMax));
+    for (int k = 1; (1 << k) <= maxDepth; k++) {
+        const std::vector<int> &prev = jump.back();
+        const std::vector<int> &prevMax = jumpMax.back();
+        std::vector<int> next(n), nextMax(n);
+        for (int v = 0; v < n; v++) {
+            next[v] = prev[prev[v]];
+            nextMax[v] = std::max(prevMax[v], prevMax[prev[v]]);
+        }
+        jump.push_back(std::move(next));
+        jumpMax.push_back(std::move(nextMax));
+    }
+
+    table.push_back(std::move(level));
+    for (int half = 1; 2 * half <= n; half *= 2) {
+        const std::vector<int> &prev = table.back();
+        std::vector<int> next(n - 2 * half + 1);
+        for (int i = 0; i < static_cast<int>(next.size()); i++) {
+            next[i] = std::min(prev[i], prev[i + half]);
+        }
+        table.push_back(std::move(next));
+    }
+}
+
+bool TreeIndex::connected(int u, int v) const {
+    int n = getNumVertices();
+    if (u < 0 || u >= n || v < 0 || v >= n) {
+        return false;
+    }
+    return root[u] == root[v];
+}
+
+int TreeIndex::lca(int u, int v) const {
+    if (!connected(u, v)) {
+        return -1;
+    }
+    if (u == v) {
+        return u;
+    }
+
+    int l = std::min(pos[u], pos[v]) + 1;
+    int r = std::max(pos[u], pos[v]) + 1;
+    int k = std::bit_width(static_cast<unsigned>(r - l)) - 1;
+    return order[std::min(table[k][l], table[k][r - (1 << k)])];
+}
+
+long long TreeIndex::distance(int u, int v) const {
+    int a = lca(u, v);
+    if (a < 0) {
+        return NO_PATH;
+    }
+    return rootDist[u] + rootDist[v] - 2 * rootDist[a];
+}
+
+long long TreeIndex::bottleneck(int u, int v) const {
+    int a = lca(u, v);
+    if (a < 0 || u == v) {
+        return NO_PATH;
+    }
+    return std::max(climbMax(u, depth[u] - depth[a]), climbMax(v, depth[v] - depth[a]));
+}
+
+int TreeIndex::climbMax(int v, int steps) const {
+    int heaviest = INT_MIN;
+    for (int k = 0; steps > 0; k++, steps >>= 1) {
+        if (steps & 1) {
+            heaviest = std::max(heaviest, jumpMax[k][v]);
+            v = jump[k][v];
+        }
+    }
+    return heaviest;
+}
+
+void TreeIndex::distance_batch(const std::pair<int, int> *pairs, long long *out, int count) const {
+    int first[TREE_INDEX_BATCH], second[TREE_INDEX_BATCH], level[TREE_INDEX_BATCH], ancestor[TREE_INDEX_BATCH];
+
+    for (int base = 0; base < count; base += TREE_INDEX_BATCH) {
+        int size = std::min(TREE_INDEX_BATCH, count - base);
+        const std::pair<int, int> *block = pairs + base;
+
+        // Preorder positions, the disconnected and equal pairs are answered right away
+        for (int i = 0; i < size; i++) {
+            auto [u, v] = block[i];
+            // -1: LCA still to find, -2: no path
+            ancestor[i] = -1;
+            if (!connected(u, v)) {
+                ancestor[i] = -2;
+                out[base + i] = NO_PATH;
+                continue;
+            }
+            __builtin_prefetch(&rootDist[u]);
+            __builtin_prefetch(&rootDist[v]);
+            if (u == v) {
+                ancestor[i] = u;
+                continue;
+            }
+            first[i] = std::min(pos[u], pos[v]) + 1;
+            second[i] = std::max(pos[u], pos[v]) + 1;
+            level[i] = std::bit_width(static_cast<unsigned>(second[i] - first[i])) - 1;
+            second[i] -= 1 << level[i];
+            __builtin_prefetch(&table[level[i]][first[i]]);
+            __builtin_prefetch(&table[level[i]][second[i]]);
+        }
+
+        // Range minimum of the parent positions gives the LCA
+        for (int i = 0; i < size; i++) {
+            if (ancestor[i] != -1) {
+                continue;
+            }
+            const std::vector<int> &row = table[level[i]];
+            ancestor[i] = order[std::min(row[first[i]], row[second[i]])];
+            __builtin_prefetch(&rootDist[ancestor[i]]);
+        }
+
+        for (int i = 0; i < size; i++) {
+            if (ancestor[i] >= 0) {
+                auto [u, v] = block[i];
+                out[base + i] = rootDist[u] + rootDist[v] - 2 * rootDist[ancestor[i]];
+            }
+        }
+    }
+}
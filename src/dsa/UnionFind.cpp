@@ -11,11 +11,38 @@ UnionFind::UnionFind(int _n) : n(_n), cc(_n) {
 }
 
 int UnionFind::find_parent(int node) {
-    // Path compression: make every node point directly to the root
-    if (parent[node] != node) {
-        parent[node] = find_parent(parent[node]);
+    // Path halving: make every other node on the path point to its grandparent
+    while (parent[node] != node) {
+        parent[node] = parent[parent[node]];
+        node = parent[node];
+    }
+    return node;
+}
+
+void UnionFind::find_batch(const int *nodes, int *roots, int count) {
+    for (int i = 0; i < count; i++) {
+        roots[i] = nodes[i];
+        __builtin_prefetch(&parent[nodes[i]]);
+    }
+
+    // One hop per path and round, the next hop is prefetched while the other paths advance
+    bool moved = true;
+    while (moved) {
+        moved = false;
+        for (int i = 0; i < count; i++) {
+            int p = parent[roots[i]];
+            if (p != roots[i]) {
+                roots[i] = p;
+                __builtin_prefetch(&parent[p]);
+                moved = true;
+            }
+        }
+    }
+
+    // Path compression for the nodes of the batch
+    for (int i = 0; i < count; i++) {
+        parent[nodes[i]] = roots[i];
     }
-    return parent[node];
 }
 
 bool UnionFind::unite(int x, int y) {
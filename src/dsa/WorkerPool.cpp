@@ -0,0 +1,84 @@
+#include "../../include/dsa/WorkerPool.hpp"
+#include <algorithm>
+
+WorkerPool::WorkerPool(unsigned workers) : workers(std::max(1u, workers)) {
+    // Worker 0 is whoever calls run()
+    for (unsigned i = 1; i < this->workers; i++) {
+        threads.emplace_back(&WorkerPool::loop, this, i);
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    start_cv.notify_all();
+    for (auto &thread : threads) {
+        thread.join();
+    }
+}
+
+void WorkerPool::run(const std::function<void(unsigned)> &job) {
+    std::lock_guard<std::mutex> run_lock(run_mutex);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        task = &job;
+        pending = workers - 1;
+        generation++;
+    }
+    start_cv.notify_all();
+
+    job(0);
+
+    // Wait for the other workers to finish their share
+    std::unique_lock<std::mutex> lock(mutex);
+    done_cv.wait(lock, [this] { return pending == 0; });
+    task = nullptr;
+}
+
+void WorkerPool::parallelFor(size_t count, const std::function<void(size_t, size_t, unsigned)> &body,
+                             size_t grain) {
+    if (workers == 1 || count <= grain) {
+        body(0, count, 0);
+        return;
+    }
+    size_t chunk = (count + workers - 1) / workers;
+    run([&](unsigned worker) {
+        size_t begin = std::min(count, worker * chunk);
+        size_t end = std::min(count, begin + chunk);
+        if (begin < end) {
+            body(begin, end, worker);
+        }
+    });
+}
+
+WorkerPool &WorkerPool::shared() {
+    static WorkerPool pool;
+    return pool;
+}
+
+void WorkerPool::loop(unsigned worker) {
+    unsigned long seen = 0;
+    while (true) {
+        const std::function<void(unsigned)> *job;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            start_cv.wait(lock, [this, seen] { return stopping || generation != seen; });
+            if (stopping) {
+                return;
+            }
+            seen = generation;
+            job = task;
+        }
+
+        (*job)(worker);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (--pending == 0) {
+                done_cv.notify_one();
+            }
+        }
+    }
+}
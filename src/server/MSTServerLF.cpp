@@ -18,6 +18,17 @@ LFThreadPool *tp = new LFThreadPool();
 pthread_mutex_t servants_mtx = PTHREAD_MUTEX_INITIALIZER;
 pthread_mutex_t tp_mtx = PTHREAD_MUTEX_INITIALIZER;
 
+// A worker serves one client session at a time, so the edges announced by
+// "Newgraph <n> <m>" are collected per thread into a single new_graph command
+thread_local std::string pending_graph;
+thread_local int pending_edges = 0;
+// Lines between "Script" and "EndScript" are collected into a single run_script command
+thread_local std::string pending_script;
+thread_local bool in_script = false;
+// The vertex pairs announced by "Distances <k>" are collected into a single distances command
+thread_local std::string pending_distances;
+thread_local int pending_pairs = 0;
+
 void *worker_function(void *arg) {
     LFThreadPool *pool = static_cast<LFThreadPool *>(arg);
     pool->join();
@@ -119,6 +130,13 @@ void handleRequest(int clientfd) {
     pthread_mutex_unlock(&servants_mtx);
     char buf[256];
     int nbytes;
+    std::string partial;
+    pending_graph.clear();
+    pending_edges = 0;
+    pending_script.clear();
+    in_script = false;
+    pending_distances.clear();
+    pending_pairs = 0;
 
     while (running) {
         nbytes = recv(clientfd, buf, sizeof(buf) - 1, 0);
@@ -126,8 +144,14 @@ void handleRequest(int clientfd) {
         if (nbytes <= 0) {
             break;
         }
-        buf[nbytes] = '\0';
-        std::string data(buf);
+        // Only complete lines are handled, the rest waits for the next recv
+        partial.append(buf, nbytes);
+        size_t end = partial.rfind('\n');
+        if (end == std::string::npos) {
+            continue;
+        }
+        std::string data = partial.substr(0, end + 1);
+        partial.erase(0, end + 1);
         handleCommand(clientfd, data);
     }
     pthread_mutex_lock(&servants_mtx);
@@ -159,7 +183,84 @@ void handleCommand(int clientfd, const std::string &input_command) {
         std::transform(lowerLine.begin(), lowerLine.end(), lowerLine.begin(), ::tolower);
         std::string processedLine;
 
-        if (lowerLine.substr(0, 8) == "newgraph") {
+        if (pending_edges > 0) {
+            // Collect the next announced edge into the pending new_graph command
+            std::istringstream iss(line);
+            std::string cmd;
+            int source, target, weight;
+            if (lowerLine.substr(0, 7) == "addedge") {
+                iss >> cmd;
+            }
+            if (iss >> source >> target >> weight) {
+                pending_graph += " " + std::to_string(source) + " " +
+                                 std::to_string(target) + " " + std::to_string(weight);
+                if (--pending_edges == 0) {
+                    executeCommand(pending_graph, clientfd, sendCallback);
+                }
+                continue;
+            }
+            // Anything else ends the edge list early
+            pending_edges = 0;
+            executeCommand(pending_graph, clientfd, sendCallback);
+        }
+
+        if (pending_pairs > 0) {
+            // Collect the next announced pairs, a line may carry several of them
+            std::istringstream iss(line);
+            int u, v;
+            bool collected = false;
+            while (pending_pairs > 0 && iss >> u >> v) {
+                pending_distances += " " + std::to_string(u) + " " + std::to_string(v);
+                pending_pairs--;
+                collected = true;
+            }
+            if (collected) {
+                if (pending_pairs == 0) {
+                    executeCommand(pending_distances, clientfd, sendCallback);
+                }
+                continue;
+            }
+            // Anything else ends the pair list early
+            pending_pairs = 0;
+            executeCommand(pending_distances, clientfd, sendCallback);
+        }
+
+        if (in_script) {
+            // Collect the script steps until EndScript
+            std::istringstream iss(line);
+            std::string cmd;
+            int source, target, weight;
+            if (lowerLine == "endscript") {
+                in_script = false;
+                executeCommand(pending_script, clientfd, sendCallback);
+            } else if (lowerLine.substr(0, 3) == "mst") {
+                pending_script += " q";
+            } else if (lowerLine.substr(0, 10) == "removeedge") {
+                if (iss >> cmd >> source >> target) {
+                    pending_script += " r " + std::to_string(source) + " " + std::to_string(target);
+                } else {
+                    sendCallback("Invalid edge format. Usage: RemoveEdge <source> <target>\n");
+                }
+            } else {
+                if (lowerLine.substr(0, 7) == "addedge") {
+                    iss >> cmd;
+                }
+                if (iss >> source >> target >> weight) {
+                    pending_script += " a " + std::to_string(source) + " " +
+                                      std::to_string(target) + " " + std::to_string(weight);
+                } else {
+                    sendCallback("Invalid script command: " + line + ". Use AddEdge, RemoveEdge, MST or EndScript\n");
+                }
+            }
+            continue;
+        }
+
+        if (lowerLine == "script") {
+            pending_script = "run_script";
+            in_script = true;
+            sendCallback("Recording script, finish it with EndScript\n");
+            continue;
+        } else if (lowerLine.substr(0, 8) == "newgraph") {
             // Extract the number of vertices
             std::istringstream iss(line);
             std::string cmd;
@@ -169,10 +270,12 @@ void handleCommand(int clientfd, const std::string &input_command) {
             if (iss >> n && n >= 0) {
                 processedLine = "new_graph " + std::to_string(n);
 
-                // If there's also an edge count, include it
+                // If there's also an edge count, wait for the edges and load them in one batch
                 int m;
-                if (iss >> m && m >= 0) {
-                    processedLine += " " + std::to_string(m);
+                if (iss >> m && m > 0) {
+                    pending_graph = processedLine + " " + std::to_string(m);
+                    pending_edges = m;
+                    continue;
                 }
             } else {
                 sendCallback("Invalid number of vertices. Usage: Newgraph <vertices> [<edges>]\n");
@@ -193,8 +296,17 @@ void handleCommand(int clientfd, const std::string &input_command) {
                 processedLine = "mst_kruskal";
             } else if (algo == "prim") {
                 processedLine = "mst_prim";
+            } else if (algo == "boruvka") {
+                processedLine = "mst_boruvka";
+            } else if (algo == "auto") {
+                processedLine = "mst_auto";
+            } else if (algo == "primforest") {
+                processedLine = "mst_prim_forest";
+            } else if (algo == "kruskalforest") {
+                processedLine = "mst_kruskal_forest";
             } else {
-                sendCallback("Invalid algorithm. Please use 'Kruskal' or 'Prim'.\n");
+                sendCallback("Invalid algorithm. Please use 'Kruskal', 'Prim', 'Boruvka', 'Auto', "
+                             "'PrimForest' or 'KruskalForest'.\n");
                 continue;
             }
         } else if (lowerLine == "exit") {
@@ -208,9 +320,19 @@ void handleCommand(int clientfd, const std::string &input_command) {
             std::string helpText = "Available commands:\n"
                     "  Newgraph <vertices> [<edges>] - Create a new graph with vertices and optional edges count\n"
                     "  AddEdge <source> <target> <weight> - Add an edge to the graph\n"
+                    "  RemoveEdge <source> <target> - Remove an edge from the graph\n"
                     "  PrintGraph - Display the current graph structure\n"
                     "  MST Kruskal - Calculate MST using Kruskal's algorithm\n"
                     "  MST Prim - Calculate MST using Prim's algorithm\n"
+                    "  MST Boruvka - Calculate MST using parallel Boruvka's algorithm\n"
+                    "  MST Auto - Calculate MST with the algorithm predicted to be fastest\n"
+                    "  MST PrimForest|KruskalForest - Minimum spanning forest, components solved in parallel\n"
+                    "  Script ... EndScript - Run AddEdge/RemoveEdge/MST lines offline, all MST weights at once\n"
+                    "  Distance <u> <v> - Tree distance between u and v in the last MST\n"
+                    "  Distances <k> - Tree distances of the k <u> <v> pairs that follow, in one response\n"
+                    "  Bottleneck <u> <v> - Heaviest edge on the MST path between u and v\n"
+                    "  Connected <u> <v> <threshold> - Whether u and v are joined by edges of weight <= threshold\n"
+                    "  ComponentSize <u> <threshold> - Vertices reachable from u over edges of weight <= threshold\n"
                     "  ResetGraph - Reset the current graph\n"
                     "  help - Display this help text\n"
                     "  exit - Close connection\n";
@@ -229,6 +351,90 @@ void handleCommand(int clientfd, const std::string &input_command) {
                 sendCallback("Invalid edge format. Usage: AddEdge <source> <target> <weight>\n");
                 continue;
             }
+        } else if (lowerLine.substr(0, 10) == "removeedge") {
+            std::istringstream iss(line);
+            std::string cmd;
+            int source, target;
+            iss >> cmd;
+
+            if (iss >> source >> target) {
+                processedLine = "remove_edge " + std::to_string(source) + " " + std::to_string(target);
+            } else {
+                sendCallback("Invalid edge format. Usage: RemoveEdge <source> <target>\n");
+                continue;
+            }
+        } else if (lowerLine.substr(0, 9) == "connected") {
+            std::istringstream iss(line);
+            std::string cmd;
+            int u, v, threshold;
+            iss >> cmd;
+
+            if (iss >> u >> v >> threshold) {
+                processedLine = "connected " + std::to_string(u) + " " + std::to_string(v) + " " +
+                                std::to_string(threshold);
+            } else {
+                sendCallback("Invalid format. Usage: Connected <u> <v> <threshold>\n");
+                continue;
+            }
+        } else if (lowerLine.substr(0, 13) == "componentsize") {
+            std::istringstream iss(line);
+            std::string cmd;
+            int u, threshold;
+            iss >> cmd;
+
+            if (iss >> u >> threshold) {
+                processedLine = "component_size " + std::to_string(u) + " " + std::to_string(threshold);
+            } else {
+                sendCallback("Invalid format. Usage: ComponentSize <u> <threshold>\n");
+                continue;
+            }
+        } else if (lowerLine.substr(0, 10) == "bottleneck") {
+            std::istringstream iss(line);
+            std::string cmd;
+            int u, v;
+            iss >> cmd;
+
+            if (iss >> u >> v) {
+                processedLine = "bottleneck " + std::to_string(u) + " " + std::to_string(v);
+            } else {
+                sendCallback("Invalid format. Usage: Bottleneck <u> <v>\n");
+                continue;
+            }
+        } else if (lowerLine.substr(0, 9) == "distances") {
+            // Distances <k> [<u> <v> ...]: the pairs may follow on the same line or on the next lines
+            std::istringstream iss(line);
+            std::string cmd;
+            int k;
+            iss >> cmd;
+
+            if (iss >> k && k >= 0) {
+                pending_distances = "distances " + std::to_string(k);
+                pending_pairs = k;
+                int u, v;
+                while (pending_pairs > 0 && iss >> u >> v) {
+                    pending_distances += " " + std::to_string(u) + " " + std::to_string(v);
+                    pending_pairs--;
+                }
+                if (pending_pairs > 0) {
+                    continue;
+                }
+                processedLine = pending_distances;
+            } else {
+                sendCallback("Invalid format. Usage: Distances <pairs> followed by the <u> <v> pairs\n");
+                continue;
+            }
+        } else if (lowerLine.substr(0, 8) == "distance") {
+            std::istringstream iss(line);
+            std::string cmd;
+            int u, v;
+            iss >> cmd;
+
+            if (iss >> u >> v) {
+                processedLine = "distance " + std::to_string(u) + " " + std::to_string(v);
+            } else {
+                sendCallback("Invalid format. Usage: Distance <u> <v>\n");
+                continue;
+            }
         } else {
             // Check if this is just a raw edge definition (when collecting edges)
             std::istringstream iss(line);
@@ -279,9 +485,19 @@ void executeCommand(const std::string &processedLine, int clientfd, std::functio
     pthread_mutex_unlock(&servants_mtx);
 
     if (cmd == "new_graph") {
-        int vertices = 0;
+        int vertices = 0, m;
         iss >> vertices;
-        servant->initGraph_i(vertices);
+        if (iss >> m && m > 0) {
+            std::vector<std::tuple<int, int, int>> batch;
+            batch.reserve(m);
+            int src, dest, weight;
+            for (int i = 0; i < m && iss >> src >> dest >> weight; i++) {
+                batch.emplace_back(src, dest, weight);
+            }
+            servant->bulkLoad_i(vertices, std::move(batch));
+        } else {
+            servant->initGraph_i(vertices);
+        }
         sendCallback("Created new graph with " + std::to_string(vertices) + " vertices\n");
     } else if (cmd == "add_edge") {
         int src, dest, weight;
@@ -290,18 +506,103 @@ void executeCommand(const std::string &processedLine, int clientfd, std::functio
             sendCallback("Added edge: " + std::to_string(src) + " -> " +
                          std::to_string(dest) + " (weight: " + std::to_string(weight) + ")\n");
         }
+    } else if (cmd == "remove_edge") {
+        int src, dest;
+        if (iss >> src >> dest) {
+            servant->removeEdge_i(src, dest);
+            sendCallback("Removed edge: " + std::to_string(src) + " -> " + std::to_string(dest) + "\n");
+        }
+    } else if (cmd == "run_script") {
+        std::vector<ScriptOp> ops = OfflineDynamicMST::parse(iss);
+        std::vector<long long> weights = servant->runScript_i(ops);
+        std::string response = "Script results (" + std::to_string(weights.size()) + " queries):\n";
+        for (size_t i = 0; i < weights.size(); i++) {
+            response += "Query " + std::to_string(i + 1) + ": total weight " + std::to_string(weights[i]) + "\n";
+        }
+        sendCallback(response);
+    } else if (cmd == "distance") {
+        int u, v;
+        if (iss >> u >> v) {
+            long long distance = servant->getDistance_i(u, v);
+            if (distance == NO_PATH) {
+                sendCallback("No path between " + std::to_string(u) + " and " + std::to_string(v) + " in the MST\n");
+            } else {
+                sendCallback("Distance between " + std::to_string(u) + " and " + std::to_string(v) + ": " +
+                             std::to_string(distance) + "\n");
+            }
+        }
+    } else if (cmd == "distances") {
+        int k = 0;
+        iss >> k;
+        std::vector<std::pair<int, int>> pairs;
+        pairs.reserve(std::max(k, 0));
+        int u, v;
+        for (int i = 0; i < k && iss >> u >> v; i++) {
+            pairs.emplace_back(u, v);
+        }
+        std::vector<long long> distances = servant->getDistances_i(pairs);
+
+        std::string response = "Distances (" + std::to_string(distances.size()) + " pairs):\n";
+        response.reserve(response.size() + distances.size() * 24);
+        for (size_t i = 0; i < distances.size(); i++) {
+            response += std::to_string(pairs[i].first) + " " + std::to_string(pairs[i].second) + ": ";
+            response += distances[i] == NO_PATH ? "no path" : std::to_string(distances[i]);
+            response += "\n";
+        }
+        sendCallback(response);
+    } else if (cmd == "bottleneck") {
+        int u, v;
+        if (iss >> u >> v) {
+            long long weight = servant->getBottleneck_i(u, v);
+            if (weight == NO_PATH) {
+                sendCallback("No MST edge between " + std::to_string(u) + " and " + std::to_string(v) + "\n");
+            } else {
+                sendCallback("Bottleneck between " + std::to_string(u) + " and " + std::to_string(v) + ": " +
+                             std::to_string(weight) + "\n");
+            }
+        }
+    } else if (cmd == "connected") {
+        int u, v, threshold;
+        if (iss >> u >> v >> threshold) {
+            bool connected = servant->isConnected_i(u, v, threshold);
+            sendCallback(std::to_string(u) + " and " + std::to_string(v) + (connected ? " are" : " are not") +
+                         " connected with edges of weight <= " + std::to_string(threshold) + "\n");
+        }
+    } else if (cmd == "component_size") {
+        int u, threshold;
+        if (iss >> u >> threshold) {
+            int size = servant->getComponentSize_i(u, threshold);
+            sendCallback("Component of " + std::to_string(u) + " with edges of weight <= " +
+                         std::to_string(threshold) + ": " + std::to_string(size) + " vertices\n");
+        }
     } else if (cmd == "print_graph") {
         std::string graphStr = servant->toString_i();
         sendCallback("Graph structure:\n" + graphStr);
     } else if (cmd == "mst_kruskal") {
-        MST result = servant->getMST_i("kruskal");
+        std::shared_ptr<const MST> result = servant->getMST_i("kruskal");
         std::string response = "MST using Kruskal's algorithm:\n";
-        response += "Total weight: " + std::to_string(result.getTotalWeight()) + "\n";
+        response += "Total weight: " + std::to_string(result->getTotalWeight()) + "\n";
         sendCallback(response);
     } else if (cmd == "mst_prim") {
-        MST result = servant->getMST_i("prim");
+        std::shared_ptr<const MST> result = servant->getMST_i("prim");
         std::string response = "MST using Prim's algorithm:\n";
-        response += "Total weight: " + std::to_string(result.getTotalWeight()) + "\n";
+        response += "Total weight: " + std::to_string(result->getTotalWeight()) + "\n";
+        sendCallback(response);
+    } else if (cmd == "mst_boruvka") {
+        std::shared_ptr<const MST> result = servant->getMST_i("boruvka");
+        std::string response = "MST using Boruvka's algorithm:\n";
+        response += "Total weight: " + std::to_string(result->getTotalWeight()) + "\n";
+        sendCallback(response);
+    } else if (cmd == "mst_auto") {
+        std::shared_ptr<const MST> result = servant->getMST_i("auto");
+        std::string response = "MST using automatic selection (" + result->getAlgorithm() + "):\n";
+        response += "Total weight: " + std::to_string(result->getTotalWeight()) + "\n";
+        sendCallback(response);
+    } else if (cmd.rfind("mst_", 0) == 0) {
+        // mst_<algo> - the suffix is the factory id of the algorithm
+        std::shared_ptr<const MST> result = servant->getMST_i(cmd.substr(4));
+        std::string response = "MST using " + result->getAlgorithm() + ":\n";
+        response += "Total weight: " + std::to_string(result->getTotalWeight()) + "\n";
         sendCallback(response);
     }
 }
@@ -309,6 +610,9 @@ void executeCommand(const std::string &processedLine, int clientfd, std::functio
 int main() {
     signal(SIGINT, signalHandler);
     signal(SIGTERM, signalHandler);
+    // Benchmark the MST algorithms before accepting clients, so no request pays for it and
+    // Prim's density switch stays the same for the whole run
+    ConcreteAlgoAuto::calibrate();
     start();
 
     return 0;
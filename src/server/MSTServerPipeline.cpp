@@ -29,6 +29,17 @@ pthread_mutex_t listener_mtx = PTHREAD_MUTEX_INITIALIZER;
 std::vector<int> active_clients;
 std::atomic<bool> running{false};
 
+// Every client has its own thread, so the edges announced by "Newgraph <n> <m>"
+// are collected per thread into a single new_graph command
+thread_local std::string pending_graph;
+thread_local int pending_edges = 0;
+// Lines between "Script" and "EndScript" are collected into a single run_script command
+thread_local std::string pending_script;
+thread_local bool in_script = false;
+// The vertex pairs announced by "Distances <k>" are collected into a single distances command
+thread_local std::string pending_distances;
+thread_local int pending_pairs = 0;
+
 //==============================================================================
 // Client handling
 //==============================================================================
@@ -60,14 +71,21 @@ void handleRequest(int clientfd) {
 
     char buf[256];
     int nbytes;
+    std::string partial;
 
     while (running) {
         nbytes = recv(clientfd, buf, sizeof(buf) - 1, 0);
         if (nbytes <= 0) {
             break;
         }
-        buf[nbytes] = '\0';
-        std::string data(buf);
+        // Only complete lines are handled, the rest waits for the next recv
+        partial.append(buf, nbytes);
+        size_t end = partial.rfind('\n');
+        if (end == std::string::npos) {
+            continue;
+        }
+        std::string data = partial.substr(0, end + 1);
+        partial.erase(0, end + 1);
         handleCommand(clientfd, data);
     }
 }
@@ -76,6 +94,14 @@ void handleCommand(int clientfd, const std::string &input_command) {
     auto sendCallback = [clientfd](std::string response) {
         send(clientfd, response.c_str(), response.length(), 0);
     };
+    auto dispatch = [clientfd, sendCallback](const std::string &processedLine) {
+        std::lock_guard<std::mutex> lock(pipeline_mtx);
+        if (pl) {
+            pl->processCommand(processedLine, clientfd, sendCallback);
+        } else {
+            sendCallback("Server error: Pipeline not initialized\n");
+        }
+    };
 
     thread_local std::stringstream stream;
     stream.clear();
@@ -94,7 +120,84 @@ void handleCommand(int clientfd, const std::string &input_command) {
         std::transform(lowerLine.begin(), lowerLine.end(), lowerLine.begin(), ::tolower);
         std::string processedLine;
 
-        if (lowerLine.substr(0, 8) == "newgraph") {
+        if (pending_edges > 0) {
+            // Collect the next announced edge into the pending new_graph command
+            std::istringstream iss(line);
+            std::string cmd;
+            int source, target, weight;
+            if (lowerLine.substr(0, 7) == "addedge") {
+                iss >> cmd;
+            }
+            if (iss >> source >> target >> weight) {
+                pending_graph += " " + std::to_string(source) + " " +
+                                 std::to_string(target) + " " + std::to_string(weight);
+                if (--pending_edges == 0) {
+                    dispatch(pending_graph);
+                }
+                continue;
+            }
+            // Anything else ends the edge list early
+            pending_edges = 0;
+            dispatch(pending_graph);
+        }
+
+        if (pending_pairs > 0) {
+            // Collect the next announced pairs, a line may carry several of them
+            std::istringstream iss(line);
+            int u, v;
+            bool collected = false;
+            while (pending_pairs > 0 && iss >> u >> v) {
+                pending_distances += " " + std::to_string(u) + " " + std::to_string(v);
+                pending_pairs--;
+                collected = true;
+            }
+            if (collected) {
+                if (pending_pairs == 0) {
+                    dispatch(pending_distances);
+                }
+                continue;
+            }
+            // Anything else ends the pair list early
+            pending_pairs = 0;
+            dispatch(pending_distances);
+        }
+
+        if (in_script) {
+            // Collect the script steps until EndScript
+            std::istringstream iss(line);
+            std::string cmd;
+            int source, target, weight;
+            if (lowerLine == "endscript") {
+                in_script = false;
+                dispatch(pending_script);
+            } else if (lowerLine.substr(0, 3) == "mst") {
+                pending_script += " q";
+            } else if (lowerLine.substr(0, 10) == "removeedge") {
+                if (iss >> cmd >> source >> target) {
+                    pending_script += " r " + std::to_string(source) + " " + std::to_string(target);
+                } else {
+                    sendCallback("Invalid edge format. Usage: RemoveEdge <source> <target>\n");
+                }
+            } else {
+                if (lowerLine.substr(0, 7) == "addedge") {
+                    iss >> cmd;
+                }
+                if (iss >> source >> target >> weight) {
+                    pending_script += " a " + std::to_string(source) + " " +
+                                      std::to_string(target) + " " + std::to_string(weight);
+                } else {
+                    sendCallback("Invalid script command: " + line + ". Use AddEdge, RemoveEdge, MST or EndScript\n");
+                }
+            }
+            continue;
+        }
+
+        if (lowerLine == "script") {
+            pending_script = "run_script";
+            in_script = true;
+            sendCallback("Recording script, finish it with EndScript\n");
+            continue;
+        } else if (lowerLine.substr(0, 8) == "newgraph") {
             std::istringstream iss(line);
             std::string cmd;
             int n;
@@ -102,8 +205,11 @@ void handleCommand(int clientfd, const std::string &input_command) {
             if (iss >> n && n >= 0) {
                 processedLine = "new_graph " + std::to_string(n);
                 int m;
-                if (iss >> m && m >= 0) {
-                    processedLine += " " + std::to_string(m);
+                if (iss >> m && m > 0) {
+                    // Wait for the m edge lines and load them in one batch
+                    pending_graph = processedLine + " " + std::to_string(m);
+                    pending_edges = m;
+                    continue;
                 }
             } else {
                 sendCallback("Invalid number of vertices. Usage: Newgraph <vertices> [<edges>]\n");
@@ -122,8 +228,17 @@ std::transform(algo.begin(), algo.end(), algo.begin(), ::tolower);
                 processedLine = "mst_kruskal";
             } else if (algo == "prim") {
                 processedLine = "mst_prim";
+            } else if (algo == "boruvka") {
+                processedLine = "mst_boruvka";
+            } else if (algo == "auto") {
+                processedLine = "mst_auto";
+            } else if (algo == "primforest") {
+                processedLine = "mst_prim_forest";
+            } else if (algo == "kruskalforest") {
+                processedLine = "mst_kruskal_forest";
             } else {
-                sendCallback("Invalid algorithm. Please use 'Kruskal' or 'Prim'.\n");
+                sendCallback("Invalid algorithm. Please use 'Kruskal', 'Prim', 'Boruvka', 'Auto', "
+                             "'PrimForest' or 'KruskalForest'.\n");
                 continue;
             }
         } else if (lowerLine == "exit") {
@@ -148,9 +263,19 @@ std::transform(algo.begin(), algo.end(), algo.begin(), ::tolower);
             std::string helpText = "Available commands:\n"
                     "  Newgraph <vertices> [<edges>] - Create a new graph with vertices and optional edges count\n"
                     "  AddEdge <source> <target> <weight> - Add an edge to the graph\n"
+                    "  RemoveEdge <source> <target> - Remove an edge from the graph\n"
                     "  PrintGraph - Display the current graph structure\n"
                     "  MST Kruskal - Calculate MST using Kruskal's algorithm\n"
                     "  MST Prim - Calculate MST using Prim's algorithm\n"
+                    "  MST Boruvka - Calculate MST using parallel Boruvka's algorithm\n"
+                    "  MST Auto - Calculate MST with the algorithm predicted to be fastest\n"
+                    "  MST PrimForest|KruskalForest - Minimum spanning forest, components solved in parallel\n"
+                    "  Script ... EndScript - Run AddEdge/RemoveEdge/MST lines offline, all MST weights at once\n"
+                    "  Distance <u> <v> - Tree distance between u and v in the last MST\n"
+                    "  Distances <k> - Tree distances of the k <u> <v> pairs that follow, in one response\n"
+                    "  Bottleneck <u> <v> - Heaviest edge on the MST path between u and v\n"
+                    "  Connected <u> <v> <threshold> - Whether u and v are joined by edges of weight <= threshold\n"
+                    "  ComponentSize <u> <threshold> - Vertices reachable from u over edges of weight <= threshold\n"
                     "  ResetGraph - Reset the current graph\n"
                     "  help - Display this help text\n"
                     "  exit - Close connection\n";
@@ -169,6 +294,90 @@ std::transform(algo.begin(), algo.end(), algo.begin(), ::tolower);
                 sendCallback("Invalid edge format. Usage: AddEdge <source> <target> <weight>\n");
                 continue;
             }
+        } else if (lowerLine.substr(0, 10) == "removeedge") {
+            std::istringstream iss(line);
+            std::string cmd;
+            int source, target;
+            iss >> cmd;
+
+            if (iss >> source >> target) {
+                processedLine = "remove_edge " + std::to_string(source) + " " + std::to_string(target);
+            } else {
+                sendCallback("Invalid edge format. Usage: RemoveEdge <source> <target>\n");
+                continue;
+            }
+        } else if (lowerLine.substr(0, 9) == "connected") {
+            std::istringstream iss(line);
+            std::string cmd;
+            int u, v, threshold;
+            iss >> cmd;
+
+            if (iss >> u >> v >> threshold) {
+                processedLine = "connected " + std::to_string(u) + " " + std::to_string(v) + " " +
+                                std::to_string(threshold);
+            } else {
+                sendCallback("Invalid format. Usage: Connected <u> <v> <threshold>\n");
+                continue;
+            }
+        } else if (lowerLine.substr(0, 13) == "componentsize") {
+            std::istringstream iss(line);
+            std::string cmd;
+            int u, threshold;
+            iss >> cmd;
+
+            if (iss >> u >> threshold) {
+                processedLine = "component_size " + std::to_string(u) + " " + std::to_string(threshold);
+            } else {
+                sendCallback("Invalid format. Usage: ComponentSize <u> <threshold>\n");
+                continue;
+            }
+        } else if (lowerLine.substr(0, 10) == "bottleneck") {
+            std::istringstream iss(line);
+            std::string cmd;
+            int u, v;
+            iss >> cmd;
+
+            if (iss >> u >> v) {
+                processedLine = "bottleneck " + std::to_string(u) + " " + std::to_string(v);
+            } else {
+                sendCallback("Invalid format. Usage: Bottleneck <u> <v>\n");
+                continue;
+            }
+        } else if (lowerLine.substr(0, 9) == "distances") {
+            // Distances <k> [<u> <v> ...]: the pairs may follow on the same line or on the next lines
+            std::istringstream iss(line);
+            std::string cmd;
+            int k;
+            iss >> cmd;
+
+            if (iss >> k && k >= 0) {
+                pending_distances = "distances " + std::to_string(k);
+                pending_pairs = k;
+                int u, v;
+                while (pending_pairs > 0 && iss >> u >> v) {
+                    pending_distances += " " + std::to_string(u) + " " + std::to_string(v);
+                    pending_pairs--;
+                }
+                if (pending_pairs > 0) {
+                    continue;
+                }
+                processedLine = pending_distances;
+            } else {
+                sendCallback("Invalid format. Usage: Distances <pairs> followed by the <u> <v> pairs\n");
+                continue;
+            }
+        } else if (lowerLine.substr(0, 8) == "distance") {
+            std::istringstream iss(line);
+            std::string cmd;
+            int u, v;
+            iss >> cmd;
+
+            if (iss >> u >> v) {
+                processedLine = "distance " + std::to_string(u) + " " + std::to_string(v);
+            } else {
+                sendCallback("Invalid format. Usage: Distance <u> <v>\n");
+                continue;
+            }
         } else {
 std::istringstream iss(line);
             int source, target, weight;
@@ -179,14 +388,8 @@ std::istringstream iss(line);
                 sendCallback("Invalid command: " + line + "\n");
                 continue;
             }
-        } {
-            std::lock_guard<std::mutex> lock(pipeline_mtx);
-            if (pl) {
-                pl->processCommand(processedLine, clientfd, sendCallback);
-            } else {
-                sendCallback("Server error: Pipeline not initialized\n");
-            }
         }
+        dispatch(processedLine);
     }
 }
 
@@ -322,6 +525,9 @@ pthread_join(accept_thread, nullptr);
 int main() {
     signal(SIGINT, signalHandler);
     signal(SIGTERM, signalHandler);
+    // Benchmark the MST algorithms before accepting clients, so no request pays for it and
+    // Prim's density switch stays the same for the whole run
+    ConcreteAlgoAuto::calibrate();
     start();
 
     return 0;
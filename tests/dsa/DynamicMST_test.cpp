@@ -0,0 +1,238 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../doctest.h"
+#include "../../include/dsa/DynamicMST.hpp"
+#include "../../include/dsa/ConcreteAlgoKruskal.hpp"
+#include "../../include/dsa/LinkCutTree.hpp"
+#include "../../include/dsa/OfflineDynamicMST.hpp"
+#include <algorithm>
+#include <random>
+#include <sstream>
+
+// Helper: from-scratch minimum spanning forest
+MST recompute(Graph& g) {
+    ConcreteAlgoKruskal kruskal;
+    MST* mst = kruskal.execute(g);
+    MST result = *mst;
+    delete mst;
+    return result;
+}
+
+long long recomputedWeight(Graph& g) {
+    return recompute(g).getTotalWeight();
+}
+
+TEST_CASE("Link-cut tree") {
+    // Path 0 - 1 - 2 - 3 with edge nodes 4, 5, 6 carrying the weights
+    LinkCutTree tree(4, -1000);
+    int a = tree.addNode(5), b = tree.addNode(9), c = tree.addNode(2);
+    tree.link(0, a);
+    tree.link(a, 1);
+    tree.link(1, b);
+    tree.link(b, 2);
+    tree.link(2, c);
+    tree.link(c, 3);
+
+    CHECK(tree.connected(0, 3));
+    CHECK_EQ(tree.pathMax(0, 3), b);
+    CHECK_EQ(tree.pathMax(3, 2), c);
+    CHECK_EQ(tree.pathMax(0, 1), a);
+
+    tree.setValue(a, 20);
+    CHECK_EQ(tree.pathMax(3, 0), a);
+
+    tree.cut(1, b);
+    CHECK_FALSE(tree.connected(0, 3));
+    CHECK(tree.connected(2, 3));
+    CHECK(tree.connected(0, 1));
+}
+
+TEST_CASE("Incremental MST") {
+    SUBCASE("Replaces the heaviest edge of the closed cycle") {
+        DynamicMST forest(4);
+        forest.addEdge(0, 1, 4);
+        forest.addEdge(1, 2, 7);
+        forest.addEdge(2, 3, 1);
+        CHECK_EQ(forest.getTotalWeight(), 12);
+        CHECK_EQ(forest.getNumEdges(), 3);
+
+        // 0 - 2 closes the cycle 0 - 1 - 2, edge (1,2) is the heaviest on it
+        forest.addEdge(0, 2, 3);
+        CHECK_EQ(forest.getTotalWeight(), 8);
+        // Heavier than everything on the path, stays out
+        forest.addEdge(3, 0, 10);
+        CHECK_EQ(forest.getTotalWeight(), 8);
+        CHECK_EQ(forest.toMST().getEdges().count({1, 2, 7}), 0);
+    }
+
+    SUBCASE("Follows random insertions like a full recompute") {
+        std::mt19937 rng(11);
+        const int n = 300;
+        Graph g(n, 0);
+        DynamicMST forest(n);
+        for (int step = 0; step < 3000; step++) {
+            int u = static_cast<int>(rng() % n), v = static_cast<int>(rng() % n);
+            int w = static_cast<int>(rng() % 1000) - 200;
+            g.addEdge(u, v, w);
+            forest.addEdge(u, v, w);
+            if (step % 100 == 0) {
+                CHECK_EQ(forest.getTotalWeight(), recomputedWeight(g));
+            }
+        }
+        CHECK_EQ(forest.getTotalWeight(), recomputedWeight(g));
+        CHECK_EQ(forest.toMST().getTotalWeight(), recomputedWeight(g));
+    }
+}
+
+TEST_CASE("Fully dynamic MST") {
+    SUBCASE("Removing a tree edge links the lightest replacement") {
+        DynamicMST forest(4);
+        forest.addEdge(0, 1, 1);
+        forest.addEdge(1, 2, 1);
+        forest.addEdge(2, 3, 1);
+        forest.addEdge(0, 2, 5);
+        forest.addEdge(3, 1, 4);
+        CHECK_EQ(forest.getTotalWeight(), 3);
+
+        // Non-tree edge: nothing changes
+        forest.removeEdge(0, 2);
+        CHECK_EQ(forest.getTotalWeight(), 3);
+        // Tree edge: 3 - 1 is the only edge left across the cut
+        forest.removeEdge(1, 2);
+        CHECK_EQ(forest.getTotalWeight(), 6);
+        CHECK_EQ(forest.getNumEdges(), 3);
+        // No replacement: the forest splits
+        forest.removeEdge(0, 1);
+        CHECK_EQ(forest.getNumEdges(), 2);
+        CHECK_EQ(forest.getTotalWeight(), 5);
+    }
+
+    SUBCASE("A heavier tree edge can lose its place") {
+        DynamicMST forest(3);
+        forest.addEdge(0, 1, 1);
+        forest.addEdge(1, 2, 2);
+        forest.addEdge(0, 2, 3);
+        forest.addEdge(1, 2, 10);
+        CHECK_EQ(forest.getTotalWeight(), 4);
+        forest.addEdge(0, 2, 20);
+        CHECK_EQ(forest.getTotalWeight(), 11);
+    }
+
+    SUBCASE("Follows a mix with 40% removals like a full recompute") {
+        std::mt19937 rng(17);
+        for (int n : {8, 60, 400}) {
+            Graph g(n, 0);
+            DynamicMST forest(n);
+            std::vector<std::pair<int, int>> present;
+            for (int step = 0; step < 4000; step++) {
+                unsigned roll = rng() % 10;
+                if (roll < 4 && !present.empty()) {
+                    size_t i = rng() % present.size();
+                    auto [u, v] = present[i];
+                    present[i] = present.back();
+                    present.pop_back();
+                    g.removeEdge(u, v);
+                    forest.removeEdge(u, v);
+                } else {
+                    int u = static_cast<int>(rng() % n), v = static_cast<int>(rng() % n);
+                    // Re-weighting an existing edge half of the time
+                    if (roll < 7 && !present.empty()) {
+                        std::tie(u, v) = present[rng() % present.size()];
+                    } else if (u != v) {
+                        present.emplace_back(u, v);
+                    }
+                    int w = static_cast<int>(rng() % 50);
+                    g.addEdge(u, v, w);
+                    forest.addEdge(u, v, w);
+                }
+                if (step % 50 == 0) {
+                    MST full = recompute(g);
+                    CHECK_EQ(forest.getTotalWeight(), full.getTotalWeight());
+                    CHECK_EQ(forest.getNumEdges(), static_cast<int>(full.getEdges().size()));
+                }
+            }
+        }
+    }
+
+    SUBCASE("Edges come out in the same order whatever the history") {
+        DynamicMST first(5), second(5);
+        std::vector<std::tuple<int, int, int>> edges = {{3, 4, 2}, {0, 1, 5}, {2, 3, 1}, {1, 2, 4}, {0, 4, 9}};
+        for (const auto& [s, t, w] : edges) {
+            first.addEdge(s, t, w);
+        }
+        for (auto it = edges.rbegin(); it != edges.rend(); ++it) {
+            second.addEdge(std::get<0>(*it), std::get<1>(*it), std::get<2>(*it));
+        }
+        second.removeEdge(0, 1);
+        second.addEdge(0, 1, 5);
+
+        MST mst = first.toMST();
+        const auto& list = mst.getEdgeList();
+        CHECK(std::is_sorted(list.begin(), list.end()));
+        CHECK(list == second.toMST().getEdgeList());
+    }
+
+    SUBCASE("Seeded from a computed forest") {
+        std::mt19937 rng(5);
+        const int n = 200;
+        Graph g(n, 0);
+        for (int i = 0; i < 1000; i++) {
+            g.addEdge(static_cast<int>(rng() % n), static_cast<int>(rng() % n), static_cast<int>(rng() % 100));
+        }
+        DynamicMST forest(g.getCSR(), recompute(g));
+        CHECK_EQ(forest.getTotalWeight(), recomputedWeight(g));
+
+        const auto& adj = g.getGraph();
+        for (int u = 0; u < n; u += 3) {
+            if (adj[u].empty()) continue;
+            int v = adj[u].front().first;
+            g.removeEdge(u, v);
+            forest.removeEdge(u, v);
+        }
+        CHECK_EQ(forest.getTotalWeight(), recomputedWeight(g));
+    }
+}
+
+TEST_CASE("Offline dynamic MST") {
+    SUBCASE("Parses script tokens") {
+        std::istringstream in("a 0 1 5 q r 0 1 q");
+        std::vector<ScriptOp> ops = OfflineDynamicMST::parse(in);
+        REQUIRE_EQ(ops.size(), 4);
+        CHECK_EQ(ops[0].kind, ScriptOp::Add);
+        CHECK_EQ(ops[0].w, 5);
+        CHECK_EQ(ops[2].kind, ScriptOp::Remove);
+        CHECK_EQ(ops[3].kind, ScriptOp::Query);
+    }
+
+    SUBCASE("Answers every query like a full recompute") {
+        std::mt19937 rng(23);
+        for (int round = 0; round < 50; round++) {
+            int n = 2 + static_cast<int>(rng() % 40);
+            Graph g(n, 0);
+            for (int i = 0; i < 2 * n; i++) {
+                g.addEdge(static_cast<int>(rng() % n), static_cast<int>(rng() % n), static_cast<int>(rng() % 30) - 10);
+            }
+            CSRGraph initial = g.getCSR();
+
+            std::vector<ScriptOp> ops;
+            std::vector<long long> expected;
+            for (int step = 0; step < 300; step++) {
+                ScriptOp op{ScriptOp::Query};
+                int roll = static_cast<int>(rng() % 10);
+                op.s = static_cast<int>(rng() % n);
+                op.t = static_cast<int>(rng() % n);
+                if (roll < 4) {
+                    op.kind = ScriptOp::Add;
+                    op.w = static_cast<int>(rng() % 30) - 10;
+                    g.addEdge(op.s, op.t, op.w);
+                } else if (roll < 7) {
+                    op.kind = ScriptOp::Remove;
+                    g.removeEdge(op.s, op.t);
+                } else {
+                    expected.push_back(recomputedWeight(g));
+                }
+                ops.push_back(op);
+            }
+            CHECK_EQ(OfflineDynamicMST::run(initial, ops), expected);
+        }
+    }
+}
@@ -0,0 +1,79 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../doctest.h"
+#include "../../include/dsa/Graph.hpp"
+#include "../../include/dsa/EdgeSort.hpp"
+#include <algorithm>
+#include <climits>
+#include <numeric>
+#include <random>
+
+// Helper: graph with pseudo-random weights drawn from [lo, lo + range]
+Graph createWeightedGraph(int vertices, int edgesPerVertex, long long lo, long long range) {
+    std::mt19937 rng(42);
+    Graph g(vertices, 0);
+    for (int u = 0; u < vertices; u++) {
+        for (int i = 0; i < edgesPerVertex; i++) {
+            int v = static_cast<int>(rng() % vertices);
+            g.addEdge(u, v, static_cast<int>(lo + static_cast<long long>(rng() % (range + 1))));
+        }
+    }
+    return g;
+}
+
+// Helper: the order std::stable_sort gives
+std::vector<int> referenceOrder(const CSRGraph& csr) {
+    std::vector<int> order(csr.m);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&csr](int a, int b) {
+        return csr.weights[a] < csr.weights[b];
+    });
+    return order;
+}
+
+TEST_CASE("Integer edge sorts") {
+    SUBCASE("Counting sort for a small weight range") {
+        Graph g = createWeightedGraph(500, 8, 0, 65535);
+        const CSRGraph& csr = g.getCSR();
+        CHECK_EQ(sortEdgesByWeight(csr), referenceOrder(csr));
+        CHECK_EQ(countingSortByWeight(csr, 0, 65535), referenceOrder(csr));
+    }
+
+    SUBCASE("Radix sort for a wide weight range") {
+        Graph g = createWeightedGraph(500, 8, -1000000000LL, 2000000000LL);
+        const CSRGraph& csr = g.getCSR();
+        CHECK_EQ(sortEdgesByWeight(csr), referenceOrder(csr));
+    }
+
+    SUBCASE("Radix sort across the full int range") {
+        Graph g = createWeightedGraph(300, 4, INT_MIN, 4294967295LL);
+        g.addEdge(0, 1, INT_MIN);
+        g.addEdge(1, 0, INT_MAX);
+        const CSRGraph& csr = g.getCSR();
+        CHECK_EQ(radixSortByWeight(csr, INT_MIN, 4294967295u), referenceOrder(csr));
+        CHECK_EQ(sortEdgesByWeight(csr), referenceOrder(csr));
+    }
+
+    SUBCASE("Empty and single weight graphs") {
+        Graph empty(3, 0);
+        CHECK(sortEdgesByWeight(empty.getCSR()).empty());
+
+        Graph flat = createWeightedGraph(50, 3, 7, 0);
+        CHECK_EQ(sortEdgesByWeight(flat.getCSR()), referenceOrder(flat.getCSR()));
+    }
+}
+
+TEST_CASE("Parallel edge sort") {
+    SUBCASE("Same order as the sequential sort") {
+        // Large enough for every worker to get a chunk
+        Graph g = createWeightedGraph(20000, 16, -50000000LL, 100000000LL);
+        const CSRGraph& csr = g.getCSR();
+        WorkerPool pool(4);
+        CHECK_EQ(parallelSortEdgesByWeight(csr, pool), referenceOrder(csr));
+    }
+
+    SUBCASE("Small inputs fall back to the sequential sort") {
+        Graph g = createWeightedGraph(100, 4, 0, 1000);
+        WorkerPool pool(4);
+        CHECK_EQ(parallelSortEdgesByWeight(g.getCSR(), pool), referenceOrder(g.getCSR()));
+    }
+}
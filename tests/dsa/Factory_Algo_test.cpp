@@ -1,10 +1,10 @@
-#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include "../doctest.h"
 #include "../../include/dsa/Graph.hpp"
 #include "../../include/dsa/MST.hpp"
-#include "../../include/dsa/ConcreteAlgoFactory.hpp"
+#include "../../include/factory/ConcreteAlgoFactory.hpp"
 #include "../../include/dsa/ConcreteAlgoKruskal.hpp"
 #include "../../include/dsa/ConcreteAlgoPrim.hpp"
+#include <random>
 
 // Helper function to create a test graph
 Graph createTestGraph() {
@@ -45,13 +45,13 @@ TEST_CASE("Factory Pattern") {
     SUBCASE("Factory creates correct algorithm instances") {
         ConcreteAlgoFactory factory;
         
-        // Create Prim's algorithm (ID: 0)
-        AbstractProductAlgo* primAlgo = static_cast<AbstractProductAlgo*>(factory.createProduct(0));
+        // Create Prim's algorithm
+        AbstractProductAlgo* primAlgo = static_cast<AbstractProductAlgo*>(factory.createProduct(PRIM));
         CHECK(primAlgo != nullptr);
         CHECK(dynamic_cast<ConcreteAlgoPrim*>(primAlgo) != nullptr);
         
-        // Create Kruskal's algorithm (ID: 1)
-        AbstractProductAlgo* kruskalAlgo = static_cast<AbstractProductAlgo*>(factory.createProduct(1));
+        // Create Kruskal's algorithm
+        AbstractProductAlgo* kruskalAlgo = static_cast<AbstractProductAlgo*>(factory.createProduct(KRUSKAL));
         CHECK(kruskalAlgo != nullptr);
         CHECK(dynamic_cast<ConcreteAlgoKruskal*>(kruskalAlgo) != nullptr);
     }
@@ -59,8 +59,8 @@ TEST_CASE("Factory Pattern") {
     SUBCASE("Factory handles invalid IDs") {
         ConcreteAlgoFactory factory;
         
-        // Check behavior with invalid ID
-        CHECK_THROWS_AS(factory.createProduct(2), std::out_of_range);
+        // Unknown names produce no algorithm
+        CHECK(factory.createProduct("unknown") == nullptr);
     }
 }
 
@@ -69,7 +69,7 @@ TEST_CASE("MST Algorithms") {
     ConcreteAlgoFactory factory;
     
     SUBCASE("Prim's Algorithm") {
-        AbstractProductAlgo* primAlgo = static_cast<AbstractProductAlgo*>(factory.createProduct(0));
+        AbstractProductAlgo* primAlgo = static_cast<AbstractProductAlgo*>(factory.createProduct(PRIM));
         MST* primMST = primAlgo->execute(g);
         
         CHECK(primMST != nullptr);
@@ -82,7 +82,7 @@ TEST_CASE("MST Algorithms") {
     }
     
     SUBCASE("Kruskal's Algorithm") {
-        AbstractProductAlgo* kruskalAlgo = static_cast<AbstractProductAlgo*>(factory.createProduct(1));
+        AbstractProductAlgo* kruskalAlgo = static_cast<AbstractProductAlgo*>(factory.createProduct(KRUSKAL));
         MST* kruskalMST = kruskalAlgo->execute(g);
         
         CHECK(kruskalMST != nullptr);
@@ -95,10 +95,10 @@ TEST_CASE("MST Algorithms") {
     }
     
     SUBCASE("Both algorithms produce identical MST weight") {
-        AbstractProductAlgo* primAlgo = static_cast<AbstractProductAlgo*>(factory.createProduct(0));
+        AbstractProductAlgo* primAlgo = static_cast<AbstractProductAlgo*>(factory.createProduct(PRIM));
         MST* primMST = primAlgo->execute(g);
         
-        AbstractProductAlgo* kruskalAlgo = static_cast<AbstractProductAlgo*>(factory.createProduct(1));
+        AbstractProductAlgo* kruskalAlgo = static_cast<AbstractProductAlgo*>(factory.createProduct(KRUSKAL));
         MST* kruskalMST = kruskalAlgo->execute(g);
         
         CHECK_EQ(primMST->getTotalWeight(), kruskalMST->getTotalWeight());
@@ -110,10 +110,10 @@ TEST_CASE("MST Algorithms") {
     SUBCASE("Algorithms on empty graph") {
         Graph emptyGraph;
         
-        AbstractProductAlgo* primAlgo = static_cast<AbstractProductAlgo*>(factory.createProduct(0));
+        AbstractProductAlgo* primAlgo = static_cast<AbstractProductAlgo*>(factory.createProduct(PRIM));
         MST* primMST = primAlgo->execute(emptyGraph);
         
-        AbstractProductAlgo* kruskalAlgo = static_cast<AbstractProductAlgo*>(factory.createProduct(1));
+        AbstractProductAlgo* kruskalAlgo = static_cast<AbstractProductAlgo*>(factory.createProduct(KRUSKAL));
         MST* kruskalMST = kruskalAlgo->execute(emptyGraph);
         
         CHECK_EQ(primMST->getTotalWeight(), 0);
@@ -122,4 +122,388 @@ TEST_CASE("MST Algorithms") {
         delete primMST;
         delete kruskalMST;
     }
-}
\ No newline at end of file
+}
+TEST_CASE("Boruvka's Algorithm") {
+    ConcreteAlgoFactory factory;
+
+    SUBCASE("Factory creates Boruvka by name") {
+        AbstractProductAlgo* boruvkaAlgo = factory.createProduct(BORUVKA);
+        CHECK(dynamic_cast<ConcreteAlgoBoruvka*>(boruvkaAlgo) != nullptr);
+        delete boruvkaAlgo;
+    }
+
+    SUBCASE("Same weight as Kruskal with several workers") {
+        Graph g = createTestGraph();
+        WorkerPool pool(4);
+        ConcreteAlgoBoruvka boruvka(pool);
+        ConcreteAlgoKruskal kruskal;
+
+        MST* boruvkaMST = boruvka.execute(g);
+        MST* kruskalMST = kruskal.execute(g);
+
+        CHECK_EQ(boruvkaMST->getTotalWeight(), 33);
+        CHECK_EQ(boruvkaMST->getTotalWeight(), kruskalMST->getTotalWeight());
+        CHECK_EQ(boruvkaMST->getEdges().size(), g.getVertices() - 1);
+
+        delete boruvkaMST;
+        delete kruskalMST;
+    }
+
+    SUBCASE("Disconnected graph yields a spanning forest") {
+        Graph g(5, 0);
+        g.addEdge(0, 1, 4);
+        g.addEdge(1, 0, 4);
+        g.addEdge(3, 4, 2);
+
+        ConcreteAlgoBoruvka boruvka;
+        MST* forest = boruvka.execute(g);
+        CHECK_EQ(forest->getTotalWeight(), 6);
+        CHECK_EQ(forest->getEdges().size(), 2);
+        delete forest;
+    }
+}
+
+TEST_CASE("Filter-Kruskal Algorithm") {
+    ConcreteAlgoFactory factory;
+
+    SUBCASE("Matches Kruskal on the test graph") {
+        Graph g = createTestGraph();
+        AbstractProductAlgo* filterAlgo = factory.createProduct(FILTER_KRUSKAL);
+        CHECK(dynamic_cast<ConcreteAlgoFilterKruskal*>(filterAlgo) != nullptr);
+
+        MST* filterMST = filterAlgo->execute(g);
+        CHECK_EQ(filterMST->getTotalWeight(), 33);
+        CHECK_EQ(filterMST->getEdges().size(), g.getVertices() - 1);
+
+        delete filterMST;
+        delete filterAlgo;
+    }
+
+    SUBCASE("Large edge list with many equal weights") {
+        // Complete graph on 100 vertices: the recursion and the equal-pivot block are exercised
+        const int SIZE = 100;
+        Graph g(SIZE, 0);
+        for (int u = 0; u < SIZE; u++) {
+            for (int v = 0; v < SIZE; v++) {
+                if (u != v) {
+                    g.addEdge(u, v, (u * 7 + v * 13) % 5 + (v == u + 1 ? -10 : 0));
+                }
+            }
+        }
+        ConcreteAlgoFilterKruskal filterKruskal;
+        ConcreteAlgoKruskal kruskal;
+        MST* filterMST = filterKruskal.execute(g);
+        MST* kruskalMST = kruskal.execute(g);
+
+        CHECK_EQ(filterMST->getTotalWeight(), kruskalMST->getTotalWeight());
+        CHECK_EQ(filterMST->getEdges().size(), SIZE - 1);
+
+        delete filterMST;
+        delete kruskalMST;
+    }
+}
+
+TEST_CASE("Prim's Algorithm with an indexed heap") {
+    SUBCASE("Edges keep their true source vertex") {
+        // Two sources offer edges of the same weight into vertex 3
+        Graph g(4, 0);
+        g.addEdge(0, 1, 1);
+        g.addEdge(0, 2, 2);
+        g.addEdge(1, 3, 5);
+        g.addEdge(2, 3, 5);
+        g.addEdge(2, 3, 3);  // Lowers the key of vertex 3 through vertex 2
+
+        ConcreteAlgoPrim prim;
+        MST* primMST = prim.execute(g);
+
+        CHECK_EQ(primMST->getTotalWeight(), 6);
+        const auto& edges = primMST->getEdges();
+        CHECK(edges.count(std::make_tuple(0, 1, 1)) == 1);
+        CHECK(edges.count(std::make_tuple(0, 2, 2)) == 1);
+        CHECK(edges.count(std::make_tuple(2, 3, 3)) == 1);
+
+        delete primMST;
+    }
+}
+
+TEST_CASE("Dense Prim's Algorithm") {
+    ConcreteAlgoFactory factory;
+
+    SUBCASE("Factory creates dense Prim by name") {
+        AbstractProductAlgo* denseAlgo = factory.createProduct(DENSE_PRIM);
+        CHECK(dynamic_cast<ConcreteAlgoDensePrim*>(denseAlgo) != nullptr);
+
+        Graph g = createTestGraph();
+        MST* denseMST = denseAlgo->execute(g);
+        CHECK_EQ(denseMST->getTotalWeight(), 33);
+        CHECK_EQ(denseMST->getEdges().size(), g.getVertices() - 1);
+
+        delete denseMST;
+        delete denseAlgo;
+    }
+
+    SUBCASE("Same tree as Prim on a complete graph") {
+        // 37 vertices so the vector kernels also run their scalar tails
+        const int SIZE = 37;
+        Graph g(SIZE, 0);
+        for (int u = 0; u < SIZE; u++) {
+            for (int v = 0; v < SIZE; v++) {
+                if (u != v) {
+                    g.addEdge(u, v, (u * v + u + v) % 11 - 5);
+                }
+            }
+        }
+        // Far below the size floor, Prim itself would keep the heap here
+        CHECK_FALSE(ConcreteAlgoDensePrim::prefers(g.getCSR()));
+
+        ConcreteAlgoDensePrim dense;
+        ConcreteAlgoKruskal kruskal;
+        MST* denseMST = dense.execute(g);
+        MST* kruskalMST = kruskal.execute(g);
+
+        CHECK_EQ(denseMST->getEdges().size(), SIZE - 1);
+        CHECK_EQ(denseMST->getTotalWeight(), kruskalMST->getTotalWeight());
+
+        delete denseMST;
+        delete kruskalMST;
+    }
+
+    SUBCASE("Takes edges of weight INT_MAX") {
+        // Two complete halves joined only by INT_MAX edges, the tree needs exactly one of them
+        const int SIZE = 37;
+        Graph g(SIZE, 0);
+        for (int u = 0; u < SIZE; u++) {
+            for (int v = 0; v < SIZE; v++) {
+                if (u != v) {
+                    g.addEdge(u, v, (u < SIZE / 2) == (v < SIZE / 2) ? -1 - (u * v + u + v) % 7 : INT_MAX);
+                }
+            }
+        }
+        auto weights = [](const MST* mst) {
+            std::vector<int> result;
+            for (const auto& [s, t, w] : mst->getEdgeList()) {
+                result.push_back(w);
+            }
+            std::sort(result.begin(), result.end());
+            return result;
+        };
+
+        ConcreteAlgoDensePrim dense;
+        ConcreteAlgoPrim prim;
+        ConcreteAlgoKruskal kruskal;
+        MST* denseMST = dense.execute(g);
+        MST* primMST = prim.execute(g);
+        MST* kruskalMST = kruskal.execute(g);
+
+        CHECK_EQ(denseMST->getEdges().size(), SIZE - 1);
+        CHECK_EQ(weights(denseMST).back(), INT_MAX);
+        CHECK(weights(denseMST) == weights(kruskalMST));
+        CHECK(weights(primMST) == weights(kruskalMST));
+
+        delete denseMST;
+        delete primMST;
+        delete kruskalMST;
+    }
+}
+
+TEST_CASE("Automatic algorithm selection") {
+    ConcreteAlgoFactory factory;
+
+    SUBCASE("Reports its choice and matches Kruskal") {
+        Graph g = createTestGraph();
+        AbstractProductAlgo* autoAlgo = factory.createProduct(AUTO);
+        MST* autoMST = autoAlgo->execute(g);
+
+        CHECK_EQ(autoMST->getTotalWeight(), 33);
+        CHECK_FALSE(autoMST->getAlgorithm().empty());
+        CHECK_EQ(autoMST->getAlgorithm(), static_cast<ConcreteAlgoAuto*>(autoAlgo)->getChosen());
+
+        delete autoMST;
+        delete autoAlgo;
+    }
+
+    SUBCASE("Never picks Prim for a directed or disconnected graph") {
+        Graph g(4, 0);
+        g.addEdge(0, 1, 3);
+        g.addEdge(2, 3, 1);
+
+        ConcreteAlgoAuto autoAlgo;
+        MST* autoMST = autoAlgo.execute(g);
+        CHECK_EQ(autoMST->getTotalWeight(), 4);
+        CHECK_NE(autoAlgo.getChosen(), PRIM);
+        CHECK_NE(autoAlgo.getChosen(), DENSE_PRIM);
+        delete autoMST;
+    }
+
+    SUBCASE("Prim's density switch follows the calibrated model") {
+        ConcreteAlgoAuto::calibrate();
+        Graph path(DENSE_PRIM_MIN_VERTICES, 0);
+        for (int v = 1; v < DENSE_PRIM_MIN_VERTICES; v++) {
+            path.addEdge(v - 1, v, v);
+            path.addEdge(v, v - 1, v);
+        }
+        CHECK_FALSE(ConcreteAlgoDensePrim::prefers(path.getCSR()));
+        CHECK_EQ(ConcreteAlgoDensePrim::prefers(path.getCSR()),
+                 ConcreteAlgoAuto::densePrimFaster(path.getCSR().n, path.getCSR().m));
+
+        // Below the size floor even a complete graph keeps the heap
+        Graph complete(100, 0);
+        for (int u = 0; u < 100; u++) {
+            for (int v = 0; v < 100; v++) {
+                if (u != v) complete.addEdge(u, v, 1);
+            }
+        }
+        CHECK_FALSE(ConcreteAlgoDensePrim::prefers(complete.getCSR()));
+
+        // With the switch off the heap variant runs and still finds the same tree
+        Graph g = createTestGraph();
+        ConcreteAlgoPrim heapOnly(false);
+        MST* mst = heapOnly.execute(g);
+        CHECK_EQ(mst->getTotalWeight(), 33);
+        delete mst;
+    }
+
+    SUBCASE("Cheapest candidate is always a registered product") {
+        GraphFeatures f;
+        f.n = 1000;
+        f.m = 400000;
+        f.weightRange = 65535;
+        std::string choice = ConcreteAlgoAuto::choose(f, true);
+        AbstractProductAlgo* algo = factory.createProduct(choice);
+        CHECK(algo != nullptr);
+        delete algo;
+    }
+}
+
+TEST_CASE("Minimum spanning forest mode") {
+    ConcreteAlgoFactory factory;
+
+    SUBCASE("Factory creates the forest products by name") {
+        for (const char* id : {PRIM_FOREST, KRUSKAL_FOREST}) {
+            AbstractProductAlgo* algo = factory.createProduct(id);
+            CHECK(dynamic_cast<ConcreteAlgoForest*>(algo) != nullptr);
+            delete algo;
+        }
+    }
+
+    SUBCASE("Prim covers every component") {
+        // Three regions, the middle one only reachable against the edge direction
+        Graph g(7, 0);
+        g.addEdge(0, 1, 4);
+        g.addEdge(1, 2, 1);
+        g.addEdge(4, 3, 2);
+        g.addEdge(3, 5, 7);
+        g.addEdge(5, 4, 3);
+
+        ConcreteAlgoPrim prim;
+        MST* tree = prim.execute(g);
+        CHECK_EQ(tree->getTotalWeight(), 5);
+        delete tree;
+
+        WorkerPool pool(4);
+        for (const char* id : {PRIM, KRUSKAL}) {
+            ConcreteAlgoForest forest(id, pool);
+            MST* mst = forest.execute(g);
+            CHECK_EQ(mst->getTotalWeight(), 10);
+            CHECK_EQ(mst->getEdges().size(), 4);
+            // Edges keep their original direction
+            CHECK_EQ(mst->getEdges().count({4, 3, 2}), 1);
+            delete mst;
+        }
+    }
+
+    SUBCASE("Same forest as Kruskal on many regions") {
+        std::mt19937 rng(8);
+        const int regions = 200, per = 50;
+        Graph g(regions * per, 0);
+        for (int r = 0; r < regions; r++) {
+            for (int i = 0; i < 3 * per; i++) {
+                g.addEdge(r * per + static_cast<int>(rng() % per), r * per + static_cast<int>(rng() % per),
+                          static_cast<int>(rng() % 100));
+            }
+        }
+
+        WorkerPool pool(4);
+        ConcreteAlgoKruskal kruskal;
+        MST* expected = kruskal.execute(g);
+        for (const char* id : {PRIM, KRUSKAL}) {
+            ConcreteAlgoForest forest(id, pool);
+            MST* mst = forest.execute(g);
+            CHECK_EQ(mst->getTotalWeight(), expected->getTotalWeight());
+            CHECK_EQ(mst->getEdges().size(), expected->getEdges().size());
+            delete mst;
+        }
+        delete expected;
+    }
+}
+
+TEST_CASE("Kruskal reconstruction tree") {
+    // Reference: union-find over the graph edges of weight <= threshold
+    auto filtered = [](Graph& g, int threshold) {
+        UnionFind uf(g.getVertices());
+        const adj_list& adj = g.getGraph();
+        for (int u = 0; u < g.getVertices(); u++) {
+            for (const auto& [v, w] : adj[u]) {
+                if (w <= threshold) uf.unite(u, v);
+            }
+        }
+        return uf;
+    };
+
+    SUBCASE("Small graph") {
+        Graph g(6, 0);
+        g.addEdge(0, 1, 3);
+        g.addEdge(1, 2, 5);
+        g.addEdge(0, 2, 9);
+        g.addEdge(3, 4, 1);
+
+        ConcreteAlgoKruskal kruskal;
+        KruskalTree tree = kruskal.reconstructionTree(g.getCSR());
+        CHECK(tree.connected(0, 1, 3));
+        CHECK_FALSE(tree.connected(0, 2, 4));
+        CHECK(tree.connected(2, 0, 5));
+        CHECK_FALSE(tree.connected(0, 3, 100));
+        CHECK(tree.connected(5, 5, -100));
+        CHECK_FALSE(tree.connected(0, 6, 100));
+        CHECK_EQ(tree.componentSize(0, 2), 1);
+        CHECK_EQ(tree.componentSize(0, 3), 2);
+        CHECK_EQ(tree.componentSize(2, 5), 3);
+        CHECK_EQ(tree.componentSize(4, 1), 2);
+        CHECK_EQ(tree.componentSize(5, 100), 1);
+        CHECK_EQ(tree.componentSize(-1, 100), 0);
+    }
+
+    SUBCASE("Random graphs agree with a filtered union find") {
+        std::mt19937 rng(22);
+        for (int round = 0; round < 20; round++) {
+            int n = 1 + static_cast<int>(rng() % 120);
+            Graph g(n, 0);
+            int m = static_cast<int>(rng() % (2 * n + 1));
+            for (int i = 0; i < m; i++) {
+                g.addEdge(static_cast<int>(rng() % n), static_cast<int>(rng() % n), static_cast<int>(rng() % 50) - 10);
+            }
+
+            // The tree from Kruskal's sweep and the one rebuilt from another algorithm's forest agree
+            ConcreteAlgoKruskal kruskal;
+            KruskalTree swept = kruskal.reconstructionTree(g.getCSR());
+            ConcreteAlgoBoruvka boruvka;
+            MST* forest = boruvka.execute(g);
+            KruskalTree rebuilt(*forest);
+            delete forest;
+
+            for (int threshold = -12; threshold <= 42; threshold += 3) {
+                UnionFind uf = filtered(g, threshold);
+                std::vector<int> size(n, 0);
+                for (int v = 0; v < n; v++) size[uf.find_parent(v)]++;
+                for (int u = 0; u < n; u++) {
+                    CHECK_EQ(swept.componentSize(u, threshold), size[uf.find_parent(u)]);
+                    CHECK_EQ(rebuilt.componentSize(u, threshold), size[uf.find_parent(u)]);
+                    int v = static_cast<int>(rng() % n);
+                    bool expected = uf.find_parent(u) == uf.find_parent(v);
+                    CHECK_EQ(swept.connected(u, v, threshold), expected);
+                    CHECK_EQ(rebuilt.connected(u, v, threshold), expected);
+                }
+            }
+        }
+    }
+}
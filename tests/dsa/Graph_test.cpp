@@ -1,6 +1,9 @@
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include "../doctest.h"
 #include "../../include/dsa/Graph.hpp"
+#include <set>
+#include <tuple>
+#include <vector>
 
 TEST_CASE("Graph constructors") {
     SUBCASE("Default constructor") {
@@ -16,7 +19,7 @@ TEST_CASE("Graph constructors") {
     }
     
     SUBCASE("Constructor with existing adjacency list") {
-        adjList list(3);
+        adj_list list(3);
         list[0].push_back({1, 5});  // Edge from 0 to 1 with weight 5
         list[0].push_back({2, 3});  // Edge from 0 to 2 with weight 3
         list[1].push_back({2, 2});  // Edge from 1 to 2 with weight 2
@@ -180,4 +183,130 @@ TEST_CASE("Complex graph operations") {
         CHECK_EQ(graph[0].size(), 1);
         CHECK_EQ(graph[2].size(), 1);
     }
-}
\ No newline at end of file
+}
+TEST_CASE("CSR snapshot") {
+    SUBCASE("Flat arrays follow the adjacency list") {
+        Graph g(4, 0);
+        g.addEdge(0, 1, 5);
+        g.addEdge(0, 2, 3);
+        g.addEdge(2, 3, 7);
+
+        const CSRGraph& csr = g.getCSR();
+        CHECK_EQ(csr.n, 4);
+        CHECK_EQ(csr.m, 3);
+        CHECK_EQ(csr.offsets, std::vector<int>{0, 2, 2, 3, 3});
+        CHECK_EQ(csr.sources, std::vector<int>{0, 0, 2});
+        CHECK_EQ(csr.targets, std::vector<int>{1, 2, 3});
+        CHECK_EQ(csr.weights, std::vector<int>{5, 3, 7});
+        CHECK_EQ(csr.ids, std::vector<int>{0, 1, 2});
+    }
+
+    SUBCASE("Snapshot is rebuilt only after a mutation") {
+        Graph g(3, 0);
+        g.addEdge(0, 1, 5);
+
+        unsigned long epoch = g.getEpoch();
+        CHECK_EQ(g.getCSR().m, 1);
+        CHECK_EQ(g.getEpoch(), epoch);
+
+        // Adding the same edge again is not a mutation
+        g.addEdge(0, 1, 5);
+        CHECK_EQ(g.getEpoch(), epoch);
+
+        g.addEdge(0, 1, 8);
+        CHECK_NE(g.getEpoch(), epoch);
+        CHECK_EQ(g.getCSR().weights[0], 8);
+
+        g.removeEdge(0, 1);
+        CHECK_EQ(g.getCSR().m, 0);
+    }
+}
+
+TEST_CASE("Hub vertex edge index") {
+    SUBCASE("Upserts and removals above the index threshold") {
+        const int SIZE = 200;
+        Graph g(SIZE, 0);
+        for (int t = 1; t < SIZE; t++) {
+            g.addEdge(0, t, t);
+        }
+        // Updating existing edges must not add new ones
+        for (int t = 1; t < SIZE; t += 2) {
+            g.addEdge(0, t, -t);
+        }
+        // Remove every third edge, some of them twice
+        for (int t = 3; t < SIZE; t += 3) {
+            g.removeEdge(0, t);
+            g.removeEdge(0, t);
+        }
+
+        const auto& graph = g.getGraph();
+        std::set<std::pair<int, int>> expected, actual;
+        for (int t = 1; t < SIZE; t++) {
+            if (t % 3 != 0) {
+                expected.insert({t, t % 2 == 1 ? -t : t});
+            }
+        }
+        actual.insert(graph[0].begin(), graph[0].end());
+        CHECK_EQ(graph[0].size(), expected.size());
+        CHECK(actual == expected);
+    }
+
+    SUBCASE("Dropping back below the threshold") {
+        Graph g(100, 0);
+        for (int t = 1; t < 100; t++) {
+            g.addEdge(0, t, 1);
+        }
+        for (int t = 1; t < 95; t++) {
+            g.removeEdge(0, t);
+        }
+        g.addEdge(0, 96, 7);
+
+        const auto& graph = g.getGraph();
+        CHECK_EQ(graph[0].size(), 5);
+        for (const auto& edge : graph[0]) {
+            CHECK_EQ(edge.second, edge.first == 96 ? 7 : 1);
+        }
+    }
+}
+
+TEST_CASE("Bulk build from an edge batch") {
+    SUBCASE("Matches building edge by edge") {
+        std::vector<std::tuple<int, int, int>> batch = {
+            {0, 1, 5}, {2, 1, 4}, {0, 2, 3}, {0, 1, 9}, {3, 0, 1}, {5, 1, 2}, {2, 1, 6}
+        };
+        Graph incremental(4, 0);
+        for (const auto& [s, t, w] : batch) {
+            incremental.addEdge(s, t, w);
+        }
+        Graph bulk(4, batch);
+
+        for (int u = 0; u < 4; u++) {
+            std::set<std::pair<int, int>> a(incremental.getGraph()[u].begin(), incremental.getGraph()[u].end());
+            std::set<std::pair<int, int>> b(bulk.getGraph()[u].begin(), bulk.getGraph()[u].end());
+            CHECK(a == b);
+        }
+        // Last writer wins on duplicates
+        CHECK_EQ(bulk.getCSR().m, 4);
+        // The caller's batch is left as it was
+        CHECK_EQ(batch.size(), 7);
+        CHECK_EQ(batch.front(), std::make_tuple(0, 1, 5));
+        CHECK_EQ(batch.back(), std::make_tuple(2, 1, 6));
+    }
+
+    SUBCASE("Bulk built hubs are indexed") {
+        std::vector<std::tuple<int, int, int>> batch;
+        for (int t = 1; t < 100; t++) {
+            batch.emplace_back(0, t, t);
+        }
+        Graph g(100, batch);
+        g.addEdge(0, 50, -1);
+        g.removeEdge(0, 10);
+
+        const auto& graph = g.getGraph();
+        CHECK_EQ(graph[0].size(), 98);
+        for (const auto& edge : graph[0]) {
+            CHECK_NE(edge.first, 10);
+            CHECK_EQ(edge.second, edge.first == 50 ? -1 : edge.first);
+        }
+    }
+}
@@ -2,6 +2,7 @@
 #include "../doctest.h"
 #include "../../include/dsa/MST.hpp"
 #include "../../include/dsa/Graph.hpp"
+#include "../../include/dsa/TreeIndex.hpp"
 #include <stdexcept>
 #include <set>
 #include <tuple>
@@ -9,6 +10,8 @@
 #include <sstream>
 #include <iomanip>
 #include <cmath>
+#include <random>
+#include <thread>
 
 // Helper function for approximate equality
 bool approxEqual(double a, double b, double epsilon = 0.01) {
@@ -105,6 +108,81 @@ TEST_CASE("MST Edge Addition") {
     }
 }
 
+TEST_CASE("MST derived views") {
+    SUBCASE("Views follow later edges and copies keep their own") {
+        MST mst(4);
+        mst.addEdge(0, 1, 5);
+        CHECK_EQ(mst.getEdges().size(), 1);
+        CHECK_EQ(mst.getMstAdjList()[1].size(), 1);
+
+        MST copy = mst;
+        mst.addEdge(1, 2, 7);
+        CHECK_EQ(mst.getNumEdges(), 2);
+        CHECK_EQ(mst.getEdges().size(), 2);
+        CHECK_EQ(mst.getMstAdjList()[1].size(), 2);
+        CHECK_EQ(mst.findLongestDistance(), 12);
+
+        CHECK_EQ(copy.getNumEdges(), 1);
+        CHECK_EQ(copy.getEdges().size(), 1);
+        CHECK_EQ(copy.getMstAdjList()[1].size(), 1);
+        CHECK_EQ(copy.findLongestDistance(), 5);
+    }
+
+    SUBCASE("Metrics are memoized per MST and recomputed after a change") {
+        MST mst(3);
+        mst.addEdge(0, 1, 4);
+        CHECK_EQ(mst.findLongestDistance(), 4);
+        CHECK(approxEqual(mst.findAverageDistance(), 4.0));
+        std::string text = mst.toString();
+        CHECK_EQ(mst.toString(), text);
+
+        MST copy = mst;
+        mst.addEdge(1, 2, 6);
+        CHECK_EQ(mst.findLongestDistance(), 10);
+        CHECK(approxEqual(mst.findAverageDistance(), 20.0 / 3.0));
+        CHECK_NE(mst.toString(), text);
+
+        // The copy keeps the metrics of the MST it was copied from
+        CHECK_EQ(copy.findLongestDistance(), 4);
+        CHECK_EQ(copy.toString(), text);
+    }
+
+    SUBCASE("Concurrent first readers after addEdge share one set of views") {
+        MST mst(1000);
+        for (int v = 1; v < 1000; v++) {
+            mst.addEdge(v - 1, v, 1);
+        }
+        const MST& shared = mst;
+        std::vector<const adj_list*> seen(8);
+        std::vector<long long> longest(8);
+        std::vector<std::thread> readers;
+        for (int i = 0; i < 8; i++) {
+            readers.emplace_back([&, i] {
+                seen[i] = &shared.getMstAdjList();
+                longest[i] = shared.findLongestDistance();
+            });
+        }
+        for (auto& reader : readers) {
+            reader.join();
+        }
+        for (int i = 0; i < 8; i++) {
+            CHECK_EQ(seen[i], seen[0]);
+            CHECK_EQ(longest[i], 999);
+        }
+    }
+
+    SUBCASE("Edge list keeps insertion order") {
+        std::vector<std::tuple<int, int, int, int>> edges = {{2, 3, 1, 0}, {0, 1, 4, 1}, {1, 2, 2, 2}};
+        MST mst(edges, 4);
+        const auto& list = mst.getEdgeList();
+        REQUIRE_EQ(list.size(), 3);
+        CHECK_EQ(list[0], std::make_tuple(2, 3, 1));
+        CHECK_EQ(list[1], std::make_tuple(0, 1, 4));
+        CHECK_EQ(list[2], std::make_tuple(1, 2, 2));
+        CHECK_EQ(mst.getTotalWeight(), 7);
+    }
+}
+
 TEST_CASE("MST Distance Calculations") {
     SUBCASE("Longest distance in empty/single vertex MST") {
         MST empty(0);
@@ -153,6 +231,47 @@ TEST_CASE("MST Distance Calculations") {
         CHECK_EQ(tree.findLongestDistance(), 100);  // From node 3 to node 4
     }
 
+    SUBCASE("Diameter endpoints") {
+        //    1 -- 3
+        //   /
+        // 0
+        //   \
+        //    2 -- 4
+        MST tree(5);
+        tree.addEdge(0, 1, 10);
+        tree.addEdge(0, 2, 20);
+        tree.addEdge(1, 3, 30);
+        tree.addEdge(2, 4, 40);
+
+        TreePath path = tree.findDiameter();
+        CHECK_EQ(path.length, 100);
+        CHECK_EQ(std::min(path.from, path.to), 3);
+        CHECK_EQ(std::max(path.from, path.to), 4);
+    }
+
+    SUBCASE("Diameter with negative weights") {
+        // 0 -(5)- 1 -(-20)- 2 -(7)- 3: the heavy ends are not worth the middle edge
+        MST line(4);
+        line.addEdge(0, 1, 5);
+        line.addEdge(1, 2, -20);
+        line.addEdge(2, 3, 7);
+
+        TreePath path = line.findDiameter();
+        CHECK_EQ(path.length, 7);
+        CHECK_EQ(std::min(path.from, path.to), 2);
+        CHECK_EQ(std::max(path.from, path.to), 3);
+    }
+
+    SUBCASE("Diameter of a long path does not recurse") {
+        const int n = 1000000;
+        std::vector<std::tuple<int, int, int, int>> edges;
+        for (int v = 1; v < n; v++) {
+            edges.emplace_back(v - 1, v, 2, v - 1);
+        }
+        MST path(edges, n);
+        CHECK_EQ(path.findLongestDistance(), 2 * (n - 1));
+    }
+
     SUBCASE("Average distance in empty/single vertex MST") {
         MST empty(0);
         CHECK_EQ(empty.findAverageDistance(), 0.0);
@@ -185,6 +304,190 @@ TEST_CASE("MST Distance Calculations") {
 
         CHECK(approxEqual(star.findAverageDistance(), 30.0));
     }
+
+    SUBCASE("Average distance only counts pairs in the same tree") {
+        // 0 -- 1 -- 2    3 -- 4    5
+        MST forest(6);
+        forest.addEdge(0, 1, 10);
+        forest.addEdge(1, 2, 20);
+        forest.addEdge(3, 4, 40);
+
+        // (10 + 30 + 20 + 40) / 4 pairs
+        CHECK(approxEqual(forest.findAverageDistance(), 25.0));
+    }
+
+    SUBCASE("Average distance of a long path") {
+        const int n = 1000000;
+        std::vector<std::tuple<int, int, int, int>> edges;
+        for (int v = 1; v < n; v++) {
+            edges.emplace_back(v - 1, v, 3, v - 1);
+        }
+        MST path(edges, n);
+        // Mean distance on a path of n vertices is (n + 1) / 3 edges of weight 3
+        CHECK(approxEqual(path.findAverageDistance(), n + 1.0));
+    }
+}
+
+TEST_CASE("MST distance index") {
+    SUBCASE("Distances and LCA in a small tree") {
+        //    1 -- 3
+        //   /
+        // 0
+        //   \
+        //    2 -- 4
+        MST tree(5);
+        tree.addEdge(0, 1, 10);
+        tree.addEdge(0, 2, 20);
+        tree.addEdge(1, 3, 30);
+        tree.addEdge(2, 4, 40);
+        TreeIndex index(tree);
+
+        CHECK_EQ(index.lca(3, 4), 0);
+        CHECK_EQ(index.lca(3, 1), 1);
+        CHECK_EQ(index.lca(2, 2), 2);
+        CHECK_EQ(index.distance(3, 4), 100);
+        CHECK_EQ(index.distance(4, 2), 40);
+        CHECK_EQ(index.distance(1, 1), 0);
+    }
+
+    SUBCASE("Vertices in different trees or out of range") {
+        MST forest(5);
+        forest.addEdge(0, 1, 10);
+        forest.addEdge(3, 4, -20);
+        TreeIndex index(forest);
+
+        CHECK(index.connected(3, 4));
+        CHECK_EQ(index.distance(4, 3), -20);
+        CHECK_FALSE(index.connected(1, 3));
+        CHECK_EQ(index.distance(1, 3), NO_PATH);
+        CHECK_EQ(index.distance(2, 2), 0);
+        CHECK_EQ(index.lca(0, 5), -1);
+        CHECK_EQ(index.distance(-1, 0), NO_PATH);
+
+        TreeIndex empty;
+        CHECK_EQ(empty.distance(0, 0), NO_PATH);
+    }
+
+    SUBCASE("Random forests agree with a tree walk") {
+        std::mt19937 rng(19);
+        for (int round = 0; round < 50; round++) {
+            int n = 1 + rng() % 60;
+            MST forest(n);
+            for (int v = 1; v < n; v++) {
+                if (rng() % 5) {
+                    forest.addEdge(static_cast<int>(rng() % v), v, static_cast<int>(rng() % 41) - 20);
+                }
+            }
+            TreeIndex index(forest);
+            for (int u = 0; u < n; u++) {
+                for (int v = 0; v < n; v++) {
+                    int walked = forest.findShortestPathWithMstEdge(forest.getMstAdjList(), u, v);
+                    if (index.connected(u, v)) {
+                        CHECK_EQ(index.distance(u, v), walked);
+                    } else {
+                        CHECK_EQ(index.distance(u, v), NO_PATH);
+                    }
+                }
+            }
+        }
+    }
+
+    SUBCASE("Batched distances match single queries") {
+        std::mt19937 rng(20);
+        const int n = 5000;
+        MST forest(n);
+        for (int v = 1; v < n; v++) {
+            if (rng() % 50) {
+                forest.addEdge(static_cast<int>(rng() % v), v, static_cast<int>(rng() % 100));
+            }
+        }
+        TreeIndex index(forest);
+
+        // Not a multiple of the block size, with some invalid vertices and equal pairs
+        std::vector<std::pair<int, int>> pairs;
+        for (int i = 0; i < 3 * TREE_INDEX_BATCH + 17; i++) {
+            int u = static_cast<int>(rng() % (n + 2)) - 1;
+            int v = i % 10 == 0 ? u : static_cast<int>(rng() % (n + 2)) - 1;
+            pairs.emplace_back(u, v);
+        }
+        std::vector<long long> out(pairs.size());
+        index.distance_batch(pairs.data(), out.data(), static_cast<int>(pairs.size()));
+        for (size_t i = 0; i < pairs.size(); i++) {
+            CHECK_EQ(out[i], index.distance(pairs[i].first, pairs[i].second));
+        }
+    }
+
+    SUBCASE("Bottleneck edges") {
+        //    1 -- 3
+        //   /
+        // 0
+        //   \
+        //    2 -- 4
+        MST tree(6);
+        tree.addEdge(0, 1, 10);
+        tree.addEdge(0, 2, 20);
+        tree.addEdge(1, 3, 30);
+        tree.addEdge(2, 4, 5);
+        TreeIndex index(tree);
+
+        CHECK_EQ(index.bottleneck(3, 4), 30);
+        CHECK_EQ(index.bottleneck(4, 0), 20);
+        CHECK_EQ(index.bottleneck(1, 0), 10);
+        CHECK_EQ(index.bottleneck(4, 2), 5);
+        CHECK_EQ(index.bottleneck(2, 2), NO_PATH);
+        CHECK_EQ(index.bottleneck(0, 5), NO_PATH);
+    }
+
+    SUBCASE("Random forest bottlenecks agree with a tree walk") {
+        std::mt19937 rng(21);
+        for (int round = 0; round < 30; round++) {
+            int n = 1 + rng() % 80;
+            MST forest(n);
+            for (int v = 1; v < n; v++) {
+                if (rng() % 6) {
+                    // Mostly long chains, so the climbs take several jumps
+                    int p = rng() % 3 ? v - 1 : static_cast<int>(rng() % v);
+                    forest.addEdge(p, v, static_cast<int>(rng() % 201) - 100);
+                }
+            }
+            TreeIndex index(forest);
+            const adj_list& adj = forest.getMstAdjList();
+            for (int u = 0; u < n; u++) {
+                // Heaviest edge from u to every vertex of its tree
+                std::vector<long long> heaviest(n, NO_PATH);
+                std::vector<int> stack{u};
+                std::vector<bool> visited(n, false);
+                visited[u] = true;
+                while (!stack.empty()) {
+                    int x = stack.back();
+                    stack.pop_back();
+                    for (const auto& [y, w] : adj[x]) {
+                        if (!visited[y]) {
+                            visited[y] = true;
+                            heaviest[y] = std::max(heaviest[x], static_cast<long long>(w));
+                            stack.push_back(y);
+                        }
+                    }
+                }
+                for (int v = 0; v < n; v++) {
+                    CHECK_EQ(index.bottleneck(u, v), heaviest[v]);
+                }
+            }
+        }
+    }
+
+    SUBCASE("Index over a long path") {
+        const int n = 1000000;
+        std::vector<std::tuple<int, int, int, int>> edges;
+        for (int v = 1; v < n; v++) {
+            edges.emplace_back(v - 1, v, 2, v - 1);
+        }
+        MST path(edges, n);
+        TreeIndex index(path);
+        CHECK_EQ(index.distance(0, n - 1), 2LL * (n - 1));
+        CHECK_EQ(index.lca(n - 1, n / 2), n / 2);
+        CHECK_EQ(index.bottleneck(1, n - 2), 2);
+    }
 }
 
 TEST_CASE("MST String Representations") {
@@ -0,0 +1,135 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../doctest.h"
+#include "../../include/dsa/UnionFind.hpp"
+#include "../../include/dsa/ConcurrentUnionFind.hpp"
+#include "../../include/dsa/RollbackUnionFind.hpp"
+#include "../../include/dsa/WorkerPool.hpp"
+#include <atomic>
+#include <random>
+#include <utility>
+#include <vector>
+
+// Helper: pseudo-random pairs over [0, n)
+std::vector<std::pair<int, int>> createPairs(int n, int count, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::vector<std::pair<int, int>> pairs(count);
+    for (auto& p : pairs) {
+        p = {static_cast<int>(rng() % n), static_cast<int>(rng() % n)};
+    }
+    return pairs;
+}
+
+TEST_CASE("Batched union find lookups") {
+    const int n = 50000;
+    UnionFind uf(n);
+    for (auto [x, y] : createPairs(n, 40000, 4)) {
+        uf.unite(x, y);
+    }
+
+    auto pairs = createPairs(n, 64, 5);
+    std::vector<int> nodes, roots(2 * pairs.size());
+    for (auto [x, y] : pairs) {
+        nodes.push_back(x);
+        nodes.push_back(y);
+    }
+    uf.find_batch(nodes.data(), roots.data(), static_cast<int>(nodes.size()));
+
+    for (size_t i = 0; i < nodes.size(); i++) {
+        CHECK_EQ(roots[i], uf.find_parent(nodes[i]));
+        // The batch compresses the paths of its nodes
+        CHECK_EQ(uf.parent[nodes[i]], roots[i]);
+    }
+}
+
+TEST_CASE("Concurrent union find") {
+    SUBCASE("Single thread behaves like UnionFind") {
+        const int n = 1000;
+        UnionFind uf(n);
+        ConcurrentUnionFind cuf(n);
+        for (auto [x, y] : createPairs(n, 700, 1)) {
+            CHECK_EQ(cuf.unite(x, y), uf.unite(x, y));
+        }
+        CHECK_EQ(cuf.components(), uf.cc);
+        for (auto [x, y] : createPairs(n, 2000, 2)) {
+            CHECK_EQ(cuf.same_set(x, y), uf.find_parent(x) == uf.find_parent(y));
+        }
+    }
+
+    SUBCASE("Stress: concurrent unites give the sequential partition") {
+        const int n = 200000;
+        auto pairs = createPairs(n, 300000, 3);
+        UnionFind uf(n);
+        for (auto [x, y] : pairs) {
+            uf.unite(x, y);
+        }
+
+        WorkerPool pool(4);
+        for (int round = 0; round < 5; round++) {
+            ConcurrentUnionFind cuf(n);
+            std::atomic<int> linked{0};
+            // Every worker walks all pairs from a different offset, so the same sets are merged concurrently
+            pool.run([&](unsigned worker) {
+                int local = 0;
+                size_t start = worker * pairs.size() / pool.size();
+                for (size_t i = 0; i < pairs.size(); i++) {
+                    auto [x, y] = pairs[(start + i) % pairs.size()];
+                    if (cuf.unite(x, y)) local++;
+                }
+                linked += local;
+            });
+
+            CHECK_EQ(cuf.components(), uf.cc);
+            CHECK_EQ(linked.load(), n - uf.cc);
+            bool samePartition = true;
+            for (int v = 0; v < n; v++) {
+                int root = cuf.find_parent(v);
+                samePartition &= cuf.find_parent(root) == root;
+                samePartition &= cuf.same_set(v, uf.find_parent(v));
+            }
+            CHECK(samePartition);
+        }
+    }
+
+    SUBCASE("Stress: finds while other workers unite") {
+        const int n = 100000;
+        ConcurrentUnionFind cuf(n);
+        WorkerPool pool(4);
+        std::atomic<bool> wrong{false};
+        pool.run([&](unsigned worker) {
+            if (worker == 0) {
+                // One long chain, linked out of order
+                for (int v = n - 1; v > 0; v -= 2) cuf.unite(v, v - 1);
+                for (int v = 1; v + 1 < n; v += 2) cuf.unite(v, v + 1);
+                return;
+            }
+            std::mt19937 rng(worker);
+            for (int i = 0; i < 200000; i++) {
+                int v = static_cast<int>(rng() % n);
+                int root = cuf.find_parent(v);
+                // A root can only move up, so the result is always >= the node
+                if (root < v) wrong = true;
+            }
+        });
+        CHECK_FALSE(wrong.load());
+        CHECK_EQ(cuf.components(), 1);
+        CHECK(cuf.same_set(0, n - 1));
+    }
+}
+
+TEST_CASE("Rollback union find") {
+    RollbackUnionFind uf(6);
+    uf.unite(0, 1);
+    int mark = uf.snapshot();
+    uf.unite(2, 3);
+    uf.unite(1, 3);
+    CHECK_FALSE(uf.unite(0, 2));
+    CHECK_EQ(uf.cc, 3);
+    CHECK_EQ(uf.find_parent(0), uf.find_parent(3));
+
+    uf.rollback(mark);
+    CHECK_EQ(uf.cc, 5);
+    CHECK_EQ(uf.find_parent(0), uf.find_parent(1));
+    CHECK_NE(uf.find_parent(0), uf.find_parent(2));
+    CHECK_NE(uf.find_parent(2), uf.find_parent(3));
+    CHECK(uf.unite(2, 3));
+}